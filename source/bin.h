@@ -10,10 +10,17 @@ private:
     std::vector<int> yFreeItems_;
     std::vector<int> zFreeItems_;
     std::vector<int> itemsWithStackingStyle_;
+    std::vector<int> rejectedAtNrOfItems_;
+    std::vector<std::shared_ptr<Item>> packedItems_;
+    std::array<int, 3> searchCursor_;
+    int searchCursorItemTypeId_;
+    int searchCursorNrOfItems_;
+    bool searchCursorCheckedGravity_;
     std::array<int, 3> placedItemsMaxDimensions_;
     double actualVolumeUtil_;
     double actualWeightUtil_;
     std::shared_ptr<PackingContext> context_;
+    PlacementKernel placementKernel_;
 
     /**
      * @brief Removes items from the xfree axis when an item has been placed there.
@@ -66,6 +73,103 @@ private:
             end(Bin::zFreeItems_));
     };
 
+    /**
+     * @brief Get the items whose side along the given axis is free to place an item against.
+     *
+     * @param aBinAxis
+     * @return const std::vector<int>&
+     */
+    const std::vector<int> &getFreeItems(const int aBinAxis) const
+    {
+        switch (aBinAxis)
+        {
+        case constants::axis::WIDTH:
+            return Bin::xFreeItems_;
+        case constants::axis::DEPTH:
+            return Bin::yFreeItems_;
+        default:
+            return Bin::zFreeItems_;
+        };
+    };
+
+    /**
+     * @brief Checks if the search for the item can skip the positions the search cursor marks as failed.
+     *
+     * The cursor holds when the last item placed in the bin is of the same item type. A failed position keeps failing
+     * for items of that type, except when gravity is on: the last item placed may be the support a position lacked.
+     * So the cursor is not used if gravity was checked when it was built or is checked for the item now.
+     *
+     * @param aItem
+     * @return true
+     * @return false
+     */
+    template <typename Policy>
+    const bool searchCursorIsValidFor(const std::shared_ptr<Item> &aItem) const
+    {
+        return aItem->Item::itemTypeId_ >= 0 &&
+               aItem->Item::itemTypeId_ == Bin::searchCursorItemTypeId_ &&
+               (int)Bin::items_.size() == Bin::searchCursorNrOfItems_ &&
+               !Bin::searchCursorCheckedGravity_ &&
+               (!Policy::CHECKS_GRAVITY || !Bin::context_->getGravity()->gravityEnabled(aItem));
+    };
+
+    /**
+     * @brief Point the search cursor at the position where the item was just placed.
+     *
+     * Per packing direction axis the cursor holds the number of leading free items whose positions failed for the item type.
+     * The free items the search passed on earlier axes all failed, on the axis where the item was placed the ones before
+     * its position failed. The placed item is new in the free lists, the cursor stops at it so its positions are searched.
+     *
+     * @param aItemKey
+     * @param aAxisIndex index in the packing direction of the axis where the item was placed.
+     * @param aSearchedFreeItems free items of that axis as they were searched, at least up to the one the item was placed against.
+     * @param aFreeItemIndex index of the free item the item was placed against.
+     */
+    template <typename Policy>
+    void moveSearchCursor(const int aItemKey, const int aAxisIndex, const std::vector<int> &aSearchedFreeItems, const int aFreeItemIndex)
+    {
+        constexpr std::array<int, 3> packingDirection = Policy::PackingDirection::AXES;
+
+        const std::shared_ptr<Item> &item = Bin::context_->getItem(aItemKey);
+        Bin::searchCursorItemTypeId_ = item->Item::itemTypeId_;
+        Bin::searchCursorNrOfItems_ = (int)Bin::items_.size();
+        Bin::searchCursorCheckedGravity_ = Policy::CHECKS_GRAVITY && Bin::context_->getGravity()->gravityEnabled(item);
+
+        for (int axisIndex = 0; axisIndex < (int)packingDirection.size(); axisIndex++)
+        {
+            const std::vector<int> &freeItems = Bin::getFreeItems(packingDirection[axisIndex]);
+            if (axisIndex < aAxisIndex)
+            {
+                Bin::searchCursor_[axisIndex] = (int)(std::find(freeItems.begin(), freeItems.end(), aItemKey) - freeItems.begin());
+            }
+            else if (axisIndex == aAxisIndex)
+            {
+                // Free items only get removed or inserted, so the ones left of the searched part are still in the same order.
+                int nrOfFailedFreeItems = 0;
+                int searchedIndex = 0;
+                for (const int freeItemKey : freeItems)
+                {
+                    while (searchedIndex < aFreeItemIndex && aSearchedFreeItems[searchedIndex] != freeItemKey)
+                    {
+                        searchedIndex++;
+                    };
+
+                    if (searchedIndex == aFreeItemIndex)
+                    {
+                        break;
+                    };
+                    nrOfFailedFreeItems++;
+                    searchedIndex++;
+                };
+                Bin::searchCursor_[axisIndex] = nrOfFailedFreeItems;
+            }
+            else
+            {
+                Bin::searchCursor_[axisIndex] = 0;
+            };
+        };
+    };
+
     /**
      * @brief Checks if the item being placed complies with the stackingStyle of other items which cannot accept any items on top of them.
      *
@@ -81,8 +185,8 @@ private:
         {
 
             const std::shared_ptr<Item> &intersectCandidate = Bin::context_->getItem(aItemKeyInBinWithStackingStyle);
-            if (intersectCandidate->stackingStyle_ == constants::item::parameter::BOTTOM_NO_ITEMS_ON_TOP ||
-                intersectCandidate->stackingStyle_ == constants::item::parameter::NO_ITEMS_ON_TOP)
+            if (intersectCandidate->stackingStyle_ == constants::item::stackingStyle::BOTTOM_NO_ITEMS_ON_TOP ||
+                intersectCandidate->stackingStyle_ == constants::item::stackingStyle::NO_ITEMS_ON_TOP)
             {
                 if (Geometry::intersectingXY(aItemBeingPlaced, intersectCandidate))
                 {
@@ -127,28 +231,90 @@ private:
      * This is used to help narrow down the number of branches to search in the kd-tree.
      * When we know the maximum length of the item on a certain axis, we also know which
      * branches we can prune since no item would reach that far starting from a certain point.
+     * Every axis is updated, whatever axis the item was placed along, else items reaching further are missed.
      *
      * @param it
-     * @param axis
      */
-    void updatePlacedMaxItemDimensions(const std::shared_ptr<Item> it, const int axis)
+    void updatePlacedMaxItemDimensions(const std::shared_ptr<Item> it)
+    {
+        Bin::placedItemsMaxDimensions_[constants::axis::WIDTH] = std::max(Bin::placedItemsMaxDimensions_[constants::axis::WIDTH], it->Item::width_);
+        Bin::placedItemsMaxDimensions_[constants::axis::DEPTH] = std::max(Bin::placedItemsMaxDimensions_[constants::axis::DEPTH], it->Item::depth_);
+        Bin::placedItemsMaxDimensions_[constants::axis::HEIGHT] = std::max(Bin::placedItemsMaxDimensions_[constants::axis::HEIGHT], it->Item::height_);
+    };
+
+    /**
+     * @brief Checks if two double should be considered as being equal.
+     *
+     * @param double1
+     * @param double2
+     * @return true
+     * @return false
+     */
+    const bool doublesAreLooselyEqual(const double double1, const double double2) const
+    {
+        const double relative_difference_factor = 0.0001; // 0.01%
+        const double greater_magnitude = std::max(std::abs(double1), std::abs(double2));
+        return (std::abs(double1 - double2) < relative_difference_factor * greater_magnitude);
+    }
+
+    /**
+     * @brief Checks if adding an item of the given weight and volume would exceed the bins physical limits.
+     *
+     * @param aWeight
+     * @param aVolume
+     * @return true
+     * @return false
+     */
+    const bool wouldExceedPhysicalLimit(const double aWeight, const double aVolume) const
     {
-        switch (axis)
+        const bool exceedsLimit = true;
+
+        const double newBinWeight = Bin::getRealActualWeightUtil() + aWeight;
+        const double newBinVolume = Bin::getRealActualVolumeUtil() + aVolume;
+
+        if (!Bin::doublesAreLooselyEqual(newBinWeight, Bin::context_->getRequestedBin()->getMaxWeight()))
         {
-        case constants::axis::WIDTH:
-            Bin::placedItemsMaxDimensions_[constants::axis::WIDTH] = std::max(Bin::placedItemsMaxDimensions_[constants::axis::WIDTH], it->Item::width_);
-            break;
-        case constants::axis::DEPTH:
-            Bin::placedItemsMaxDimensions_[constants::axis::DEPTH] = std::max(Bin::placedItemsMaxDimensions_[constants::axis::DEPTH], it->Item::depth_);
-            break;
-        case constants::axis::HEIGHT:
-            Bin::placedItemsMaxDimensions_[constants::axis::HEIGHT] = std::max(Bin::placedItemsMaxDimensions_[constants::axis::HEIGHT], it->Item::height_);
-            break;
-        default:
-            Bin::placedItemsMaxDimensions_[constants::axis::WIDTH] = std::max(Bin::placedItemsMaxDimensions_[constants::axis::WIDTH], it->Item::width_);
-            Bin::placedItemsMaxDimensions_[constants::axis::DEPTH] = std::max(Bin::placedItemsMaxDimensions_[constants::axis::DEPTH], it->Item::depth_);
-            Bin::placedItemsMaxDimensions_[constants::axis::HEIGHT] = std::max(Bin::placedItemsMaxDimensions_[constants::axis::HEIGHT], it->Item::height_);
+            if (newBinWeight > Bin::context_->getRequestedBin()->getMaxWeight())
+            {
+                return exceedsLimit;
+            };
+        }
+
+        if (!Bin::doublesAreLooselyEqual(newBinVolume, Bin::context_->getRequestedBin()->getMaxVolume()))
+        {
+            if (newBinVolume > Bin::context_->getRequestedBin()->getMaxVolume())
+            {
+                return exceedsLimit;
+            };
         };
+
+        return !exceedsLimit;
+    }
+
+    /**
+     * @brief Checks if adding the item would exceed the bins physical limits.
+     *
+     * @param aItemKey
+     * @return true
+     * @return false
+     */
+    const bool wouldExceedPhysicalLimit(const int aItemKey) const
+    {
+        const std::shared_ptr<Item> &item = Bin::context_->peekItem(aItemKey);
+        return Bin::wouldExceedPhysicalLimit(item->Item::weight_, item->Item::volume_);
+    }
+
+    /**
+     * @brief Checks if the packer confirms to the max items per bin limit enforces by the user.
+     *
+     * @return true
+     * @return false
+     */
+    const bool wouldExceedArtificialItemLimit(const int aItemAddition) const
+    {
+
+        const int newNrOfItemsInBin = aItemAddition + ((int)Bin::items_.size());
+        return Bin::context_->getRequestedBin()->exceedsItemLimit(newNrOfItemsInBin);
     };
 
 public:
@@ -159,16 +325,21 @@ public:
 
     Bin(int aId,
         std::shared_ptr<PackingContext> aContext,
-        int aEstimatedNumberOfItemFits) : id_(aId),
-                                          type_(aContext->getRequestedBin()->getType()),
-                                          maxWeight_(aContext->getRequestedBin()->getMaxWeight()),
+        int aEstimatedNumberOfItemFits) : GeometricShape(aContext->getRequestedBin()->getWidth(),
+                                                         aContext->getRequestedBin()->getDepth(),
+                                                         aContext->getRequestedBin()->getHeight()),
+                                          searchCursor_(constants::START_POSITION),
+                                          searchCursorItemTypeId_(-1),
+                                          searchCursorNrOfItems_(0),
+                                          searchCursorCheckedGravity_(false),
+                                          placedItemsMaxDimensions_(constants::START_POSITION),
                                           actualVolumeUtil_(0.0),
                                           actualWeightUtil_(0.0),
                                           context_(aContext),
-                                          placedItemsMaxDimensions_(constants::START_POSITION),
-                                          GeometricShape(aContext->getRequestedBin()->getWidth(),
-                                                         aContext->getRequestedBin()->getDepth(),
-                                                         aContext->getRequestedBin()->getHeight())
+                                          placementKernel_(Bin::selectPlacementKernel(aContext->getRequestedBin()->getPackingDirection(), true, true)),
+                                          id_(aId),
+                                          type_(aContext->getRequestedBin()->getType()),
+                                          maxWeight_(aContext->getRequestedBin()->getMaxWeight())
     {
 
         /* Create kd-tree and reserve vector memory in advance based on estimates. */
@@ -191,6 +362,7 @@ public:
     const std::vector<int> &getFittedItems() const { return Bin::items_; };
     const std::vector<int> &getUnfittedItems() const { return Bin::unfittedItems_; };
     const std::shared_ptr<PackingContext> getContext() const { return Bin::context_; };
+    const std::vector<std::shared_ptr<Item>> &getPackedItems() const { return Bin::packedItems_; };
 
     /**
      * @brief Reset the item to inital values and add to unfitted items.
@@ -199,81 +371,347 @@ public:
      */
     void addUnfittedItem(const int itemKey)
     {
-        Bin::context_->getModifiableItem(itemKey)->reset();
+        Bin::context_->getItemRegister()->resetItem(itemKey);
         Bin::unfittedItems_.push_back(itemKey);
     };
 
     /**
-     * @brief Look for a position inside the bin to place the item.
+     * @brief Forget the unfitted items of the bin, the items themselves are left as they are.
      *
-     * This function automatically places the item in either the fitted, or unfitted items.
+     */
+    void clearUnfittedItems() { Bin::unfittedItems_.clear(); };
+
+    /**
+     * @brief Checks if adding the item would exceed the bins limits.
+     *  Seperate function because this might be extended later by custom non-physical limits.
      *
-     * @param itemToFitKey
+     * @param aItemKey
+     * @return true
+     * @return false
      */
-    void searchPositionAndPlaceItem(const int itemToFitKey)
+    const bool wouldExceedLimit(const int aItemKey) const
     {
-        bool fitted = false;
+        return Bin::wouldExceedPhysicalLimit(aItemKey) || Bin::wouldExceedArtificialItemLimit(1);
+    };
 
-        std::vector<int> itemsWithFreeCorrespondingAxis;
+    /**
+     * @brief Remember that an item was rejected, later items of its item type are rejected without searching.
+     *
+     * A rejection by the limits holds for good, the bin only gets heavier and fuller.
+     * A rejection by the position search holds until the next item is placed, which adds new positions to search.
+     * The item type id includes the gravity strength, so a rejection for lack of support never rejects an item
+     * of weaker or no gravity.
+     *
+     * @param aItemKey
+     */
+    void rememberRejectedItem(const int aItemKey)
+    {
+        const int itemTypeId = Bin::context_->peekItem(aItemKey)->Item::itemTypeId_;
+        if (itemTypeId < 0)
+        {
+            return;
+        };
+
+        if (itemTypeId >= (int)Bin::rejectedAtNrOfItems_.size())
+        {
+            Bin::rejectedAtNrOfItems_.resize(itemTypeId + 1, constants::bin::rejection::NOT_REJECTED);
+        };
+        Bin::rejectedAtNrOfItems_[itemTypeId] = Bin::wouldExceedLimit(aItemKey) ? constants::bin::rejection::ALWAYS_REJECTED : (int)Bin::items_.size();
+    };
+
+    /**
+     * @brief Checks if an item of the same item type was rejected and the rejection still holds.
+     *
+     * @param aItemKey
+     * @return true
+     * @return false
+     */
+    const bool isRejected(const int aItemKey) const
+    {
+        const int itemTypeId = Bin::context_->peekItem(aItemKey)->Item::itemTypeId_;
+        if (itemTypeId < 0 || itemTypeId >= (int)Bin::rejectedAtNrOfItems_.size())
+        {
+            return false;
+        };
+
+        const int rejectedAtNrOfItems = Bin::rejectedAtNrOfItems_[itemTypeId];
+        return rejectedAtNrOfItems == constants::bin::rejection::ALWAYS_REJECTED || rejectedAtNrOfItems == (int)Bin::items_.size();
+    };
+
+    /**
+     * @brief Checks if the bin can not take any item of at least the given weight and volume.
+     *
+     * @param aMinWeight
+     * @param aMinVolume
+     * @return true
+     * @return false
+     */
+    const bool isFullFor(const double aMinWeight, const double aMinVolume) const
+    {
+        return Bin::wouldExceedPhysicalLimit(aMinWeight, aMinVolume) || Bin::wouldExceedArtificialItemLimit(1);
+    };
+
+    /**
+     * @brief Pick the placement kernel for a packing direction, the checks left out of a kernel must not be able to reject a position.
+     *
+     * @param aPackingDirection
+     * @param aChecksGravity
+     * @param aChecksStackingStyles
+     * @return const PlacementKernel
+     */
+    static const PlacementKernel selectPlacementKernel(const std::array<int, 3> &aPackingDirection, const bool aChecksGravity, const bool aChecksStackingStyles)
+    {
+        if (aPackingDirection == constants::bin::parameter::BACK_TO_FRONT_ARRAY)
+        {
+            return Bin::selectPlacementKernel<BackToFront>(aChecksGravity, aChecksStackingStyles);
+        };
+        return Bin::selectPlacementKernel<BottomUp>(aChecksGravity, aChecksStackingStyles);
+    };
+
+    template <typename Direction>
+    static const PlacementKernel selectPlacementKernel(const bool aChecksGravity, const bool aChecksStackingStyles)
+    {
+        if (aChecksGravity)
+        {
+            return aChecksStackingStyles ? Bin::createPlacementKernel<PlacementPolicy<Direction, true, true>>()
+                                         : Bin::createPlacementKernel<PlacementPolicy<Direction, true, false>>();
+        };
+        return aChecksStackingStyles ? Bin::createPlacementKernel<PlacementPolicy<Direction, false, true>>()
+                                     : Bin::createPlacementKernel<PlacementPolicy<Direction, false, false>>();
+    };
+
+    template <typename Policy>
+    static const PlacementKernel createPlacementKernel() { return {&Bin::searchPosition<Policy>, &Bin::placeItem<Policy>}; };
+
+    /**
+     * @brief Set the placement kernel, bins use the kernel that checks everything until their packing cluster sets one.
+     *
+     * @param aPlacementKernel
+     */
+    void setPlacementKernel(const PlacementKernel &aPlacementKernel) { Bin::placementKernel_ = aPlacementKernel; };
+
+    /**
+     * @brief Look for a position inside the bin to place the item, the item is added to the fitted items if one is found.
+     *
+     * @param itemToFitKey
+     * @return true
+     * @return false
+     */
+    const bool searchPosition(const int itemToFitKey) { return (this->*Bin::placementKernel_.searchPosition_)(itemToFitKey); };
+
+    /**
+     * @brief Look for a position inside the bin to place the item, the item is added to the fitted items if one is found.
+     *
+     * Positions are searched in a fixed order, an item of the same item type as the last item placed resumes the search
+     * at the search cursor. It skips only positions that failed before, so the position found is the same as with a full search.
+     *
+     * @param itemToFitKey
+     * @return true
+     * @return false
+     */
+    template <typename Policy>
+    const bool searchPosition(const int itemToFitKey)
+    {
         std::shared_ptr<Item> &itemToFit = Bin::context_->getModifiableItem(itemToFitKey);
+        const bool resumeSearch = Bin::searchCursorIsValidFor<Policy>(itemToFit);
 
-        for (const int binAxis : Bin::context_->getRequestedBin()->getPackingDirection())
+        return Bin::searchPositionAlongAxis<Policy, 0>(itemToFitKey, itemToFit, resumeSearch) ||
+               Bin::searchPositionAlongAxis<Policy, 1>(itemToFitKey, itemToFit, resumeSearch) ||
+               Bin::searchPositionAlongAxis<Policy, 2>(itemToFitKey, itemToFit, resumeSearch);
+    };
+
+    /**
+     * @brief Try the positions against the free items of one axis of the packing direction.
+     *
+     * Placing an item changes the free items, so the searched ones the search cursor needs are copied only once the item is placed.
+     *
+     * @param itemToFitKey
+     * @param itemToFit
+     * @param aResumeSearch
+     * @return true
+     * @return false
+     */
+    template <typename Policy, int AxisIndex>
+    const bool searchPositionAlongAxis(const int itemToFitKey, std::shared_ptr<Item> &itemToFit, const bool aResumeSearch)
+    {
+        constexpr int binAxis = Policy::PackingDirection::AXES[AxisIndex];
+        const std::vector<int> &itemsWithFreeCorrespondingAxis = Bin::getFreeItems(binAxis);
+
+        for (int freeItemIndex = aResumeSearch ? Bin::searchCursor_[AxisIndex] : 0; freeItemIndex < (int)itemsWithFreeCorrespondingAxis.size(); freeItemIndex++)
         {
+            const std::shared_ptr<Item> &itemInBin = Bin::context_->getItem(itemsWithFreeCorrespondingAxis[freeItemIndex]);
+            itemToFit->Item::position_ = itemInBin->Item::position_;
 
-            if (fitted)
+            if constexpr (binAxis == constants::axis::WIDTH)
             {
-                break;
+                itemToFit->Item::position_[constants::axis::WIDTH] += itemInBin->Item::width_;
+            }
+            else if constexpr (binAxis == constants::axis::DEPTH)
+            {
+                itemToFit->Item::position_[constants::axis::DEPTH] += itemInBin->Item::depth_;
+            }
+            else
+            {
+                itemToFit->Item::position_[constants::axis::HEIGHT] += itemInBin->Item::height_;
             };
 
-            switch (binAxis)
+            if (BinCalculationCache::itemPositionCacheHit(itemToFit))
             {
-            case constants::axis::WIDTH:
-                itemsWithFreeCorrespondingAxis = Bin::xFreeItems_;
-                break;
-            case constants::axis::DEPTH:
-                itemsWithFreeCorrespondingAxis = Bin::yFreeItems_;
-                break;
-            case constants::axis::HEIGHT:
-                itemsWithFreeCorrespondingAxis = Bin::zFreeItems_;
-                break;
+                continue;
             };
 
-            for (const int itemInBinKey : itemsWithFreeCorrespondingAxis)
+            if (Bin::placeItem<Policy>(itemToFitKey))
             {
-                const std::shared_ptr<Item> &itemInBin = Bin::context_->getItem(itemInBinKey);
-                itemToFit->Item::position_ = itemInBin->Item::position_;
+                const std::vector<int> searchedFreeItems(itemsWithFreeCorrespondingAxis.begin(), itemsWithFreeCorrespondingAxis.begin() + freeItemIndex + 1);
+                Bin::addFittedItem(itemToFitKey);
+                Bin::moveSearchCursor<Policy>(itemToFitKey, AxisIndex, searchedFreeItems, freeItemIndex);
+                return true;
+            };
+        };
 
-                switch (binAxis)
-                {
-                case constants::axis::WIDTH:
-                    itemToFit->Item::position_[constants::axis::WIDTH] += itemInBin->Item::width_;
-                    break;
-                case constants::axis::DEPTH:
-                    itemToFit->Item::position_[constants::axis::DEPTH] += itemInBin->Item::depth_;
-                    break;
-                case constants::axis::HEIGHT:
-                    itemToFit->Item::position_[constants::axis::HEIGHT] += itemInBin->Item::height_;
-                    break;
-                };
+        return false;
+    };
 
-                if (BinCalculationCache::itemPositionCacheHit(itemToFit))
-                {
-                    continue;
-                };
+    /**
+     * @brief Look for a position inside the bin to place the item.
+     *
+     * This function automatically places the item in either the fitted, or unfitted items.
+     *
+     * @param itemToFitKey
+     */
+    void searchPositionAndPlaceItem(const int itemToFitKey)
+    {
+        if (!Bin::searchPosition(itemToFitKey))
+        {
+            Bin::rememberRejectedItem(itemToFitKey);
+            Bin::addUnfittedItem(itemToFitKey);
+        };
+    };
 
-                if (Bin::placeItem(itemToFitKey))
-                {
-                    fitted = true;
-                    Bin::addFittedItem(itemToFitKey, binAxis);
-                    break;
-                }
+    /**
+     * @brief Place an item in the rotation and at the position of an item of the same item type, without searching.
+     *
+     * Used to copy a bin, the placed item may be in another bin of the same context. No gravity or stacking style check is done,
+     * the item type id covers everything these checks depend on.
+     *
+     * @param aItemKey
+     * @param aPlacedItemKey
+     */
+    void placeItemAs(const int aItemKey, const int aPlacedItemKey)
+    {
+        const std::array<int, 3> position = Bin::context_->getItem(aPlacedItemKey)->Item::position_;
+        const int rotationType = Bin::context_->getItem(aPlacedItemKey)->Item::rotationType_;
+
+        std::shared_ptr<Item> &item = Bin::context_->getModifiableItem(aItemKey);
+        item->Item::position_ = position;
+        item->Item::rotate(rotationType);
+        Bin::addFittedItem(aItemKey);
+    };
+
+    /**
+     * @brief Add the items placed in a zone of the bin, a bin of the same item register holding a slice of this bin.
+     *
+     * The items keep their rotation and are moved along the depth to the start of the zone.
+     * Items which would exceed the limits of this bin are reset and left out, so they can still be packed later.
+     *
+     * @param aZone
+     * @param aZoneStartDepth
+     * @return const std::vector<int> the items added.
+     */
+    const std::vector<int> addZoneItems(const Bin &aZone, const int aZoneStartDepth)
+    {
+        std::vector<int> addedItems;
+        for (const int itemKey : aZone.getFittedItems())
+        {
+            if (Bin::wouldExceedLimit(itemKey))
+            {
+                Bin::context_->getItemRegister()->resetItem(itemKey);
+                continue;
             };
+
+            std::shared_ptr<Item> &item = Bin::context_->getModifiableItem(itemKey);
+            item->Item::position_[constants::axis::DEPTH] += aZoneStartDepth;
+            item->Item::rotate(item->Item::rotationType_);
+            Bin::addFittedItem(itemKey);
+            addedItems.push_back(itemKey);
         };
 
-        if (!fitted)
+        return addedItems;
+    };
+
+    /**
+     * @brief Free the structures used to search positions, for a bin no item will be placed in anymore.
+     *
+     * The fitted items and totals are kept, so the bin can still be evaluated and picked as result.
+     *
+     */
+    void releaseSearchStructures()
+    {
+        Bin::kdTree_.reset();
+        std::vector<int>().swap(Bin::xFreeItems_);
+        std::vector<int>().swap(Bin::yFreeItems_);
+        std::vector<int>().swap(Bin::zFreeItems_);
+        std::vector<int>().swap(Bin::itemsWithStackingStyle_);
+        std::vector<int>().swap(Bin::rejectedAtNrOfItems_);
+        BinCalculationCache::clearIntersections();
+        Bin::searchCursorItemTypeId_ = -1;
+    };
+
+    /**
+     * @brief Turn the bin into a result record once it is final.
+     *
+     * The bin keeps its placed items and releases the packing context, so the item register of its packer can be freed.
+     *
+     */
+    void compactToResult()
+    {
+        Bin::releaseSearchStructures();
+
+        Bin::packedItems_.reserve(Bin::items_.size());
+        for (const int itemKey : Bin::items_)
         {
-            Bin::addUnfittedItem(itemToFitKey);
+            Bin::packedItems_.push_back(Bin::context_->getItem(itemKey));
         };
+
+        std::vector<int>().swap(Bin::unfittedItems_);
+        Bin::context_.reset();
+    };
+
+    /**
+     * @brief Continue packing the bin, the items are placed against the items already in the bin.
+     *
+     * Items which do not fit are reset and left out, they are not added to the unfitted items of the bin.
+     *
+     * @param aItemKeys
+     * @return true if all items were placed.
+     * @return false
+     */
+    const bool addItems(const std::vector<int> &aItemKeys)
+    {
+        int lastUnfittedItemKey = -1;
+
+        // The items may not be the ones the bin was packed with, the kernel has to check what they or the items in the bin need.
+        Bin::setPlacementKernel(Bin::selectPlacementKernel(Bin::context_->getRequestedBin()->getPackingDirection(),
+                                                           Bin::context_->getGravity()->gravityEnabledForAny(aItemKeys),
+                                                           !Bin::itemsWithStackingStyle_.empty() || Bin::context_->getItemRegister()->containsItemWithStackingStyle(aItemKeys)));
+
+        for (const int itemKey : aItemKeys)
+        {
+            // An item equal to the last item which did not fit will not fit either.
+            if (lastUnfittedItemKey >= 0 && Bin::context_->getItemRegister()->itemsAreEqual(itemKey, lastUnfittedItemKey))
+            {
+                continue;
+            };
+
+            Bin::context_->getItemRegister()->resetItem(itemKey);
+            if (Bin::wouldExceedLimit(itemKey) || !Bin::searchPosition(itemKey))
+            {
+                Bin::context_->getItemRegister()->resetItem(itemKey);
+                lastUnfittedItemKey = itemKey;
+            };
+        };
+
+        return lastUnfittedItemKey < 0;
     };
 
     /**
@@ -283,14 +721,26 @@ public:
      * @return true
      * @return false
      */
+    const bool placeItem(const int aItemBeingPlacedKey) { return (this->*Bin::placementKernel_.placeItem_)(aItemBeingPlacedKey); };
+
+    /**
+     * @brief Tries to place an item inside a bin, on a specific location.
+     *
+     * @param it
+     * @return true
+     * @return false
+     */
+    template <typename Policy>
     const bool placeItem(const int aItemBeingPlacedKey)
     {
         bool intersectionFound = false;
         std::shared_ptr<Item> &itemBeingPlaced = Bin::context_->getModifiableItem(aItemBeingPlacedKey);
+        std::vector<int> intersectCandidates;
+        std::vector<int> gravitySupportCandidates;
 
         /* Loop over items allowed rotation in order to find a fitting place. */
         for (int stringCharCounter = 0;
-             stringCharCounter < itemBeingPlaced->Item::allowedRotations_.std::string::size();
+             stringCharCounter < (int)itemBeingPlaced->Item::allowedRotations_.std::string::size();
              stringCharCounter++)
         {
             /* Rotate item according to current rotation type. */
@@ -305,8 +755,8 @@ public:
             };
 
             /* Search kdTree to find items which could be intersecting. */
-            std::vector<int> intersectCandidates = {};
-            std::vector<int> gravitySupportCandidates = {};
+            intersectCandidates.clear();
+            gravitySupportCandidates.clear();
             Bin::kdTree_->getIntersectCandidates(Bin::kdTree_->KdTree::getRoot(),
                                                  Bin::kdTree_->KdTree::getRoot()->Node::myDepth_,
                                                  itemBeingPlaced->Item::position_,
@@ -338,9 +788,9 @@ public:
                     // std::cout << intersectCandidate->id_ << " " << intersectCandidate->allowedRotations_ << " " << intersectCandidate->position_[0] << " " << intersectCandidate->position_[1] << " " << intersectCandidate->position_[2] << " " << intersectCandidate->width_ << " " << intersectCandidate->depth_ << " " << intersectCandidate->height_ << " " << intersectCandidate->furthestPointWidth_ << " " << intersectCandidate->furthestPointDepth_ << " " << intersectCandidate->furthestPointHeight_ << "\n";
                     break;
                 }
-                else
+                else if constexpr (Policy::CHECKS_GRAVITY)
                 {
-                    // Store the item as a gravity candidate. Saves computation. This is always performed but is only actually relevant if gravity is enabled.
+                    // Store the item as a gravity candidate. Saves computation. Only relevant if gravity is enabled.
                     if (itemBeingPlaced->Item::position_[constants::axis::HEIGHT] == intersectCandidate->Item::furthestPointHeight_)
                     {
                         gravitySupportCandidates.push_back(intersectCandidate->transientSysId_);
@@ -359,16 +809,22 @@ public:
             This check is applied after an otherwise fitting item is found. */
 
             // TODO - test this with intersectCandidates instead of getFittedItems()
-            if (!Bin::context_->getGravity()->itemObeysGravity(itemBeingPlaced, gravitySupportCandidates, true))
+            if constexpr (Policy::CHECKS_GRAVITY)
             {
-                continue;
+                if (!Bin::context_->getGravity()->itemObeysGravity(itemBeingPlaced, gravitySupportCandidates, true))
+                {
+                    continue;
+                };
             };
 
             /* Check if item stacking styles are respected. */
-            if (!Bin::stackingStyleCompliant(itemBeingPlaced))
+            if constexpr (Policy::CHECKS_STACKING_STYLES)
             {
-                continue;
-            }
+                if (!Bin::stackingStyleCompliant(itemBeingPlaced))
+                {
+                    continue;
+                };
+            };
 
             /* If this point is reached, the item fits in the bin. */
             return true;
@@ -382,9 +838,8 @@ public:
      * @brief Update everything that needs to be updated once an item has found a fitting spot inside the bin.
      *
      * @param it
-     * @param binAxis
      */
-    void addFittedItem(const int &it, const int &aBinAxis)
+    void addFittedItem(const int &it)
     {
         const std::shared_ptr<Item> &newlyAddedItem = context_->getItem(it);
 
@@ -394,7 +849,7 @@ public:
         Bin::furthestPointWidth_ = std::max(Bin::furthestPointWidth_, newlyAddedItem->Item::furthestPointWidth_);
         Bin::furthestPointDepth_ = std::max(Bin::furthestPointDepth_, newlyAddedItem->Item::furthestPointDepth_);
         Bin::furthestPointHeight_ = std::max(Bin::furthestPointHeight_, newlyAddedItem->Item::furthestPointHeight_);
-        Bin::updatePlacedMaxItemDimensions(newlyAddedItem, aBinAxis);
+        Bin::updatePlacedMaxItemDimensions(newlyAddedItem);
         Bin::kdTree_->KdTree::addItemKeyToLeafHelper(it,
                                                      {newlyAddedItem->Item::furthestPointWidth_,
                                                       newlyAddedItem->Item::furthestPointDepth_,
@@ -404,7 +859,7 @@ public:
         Bin::xFreeItems_.push_back(it);
         Bin::yFreeItems_.push_back(it);
 
-        if (newlyAddedItem->stackingStyle_ != constants::item::parameter::ALLOW_ALL)
+        if (newlyAddedItem->stackingStyle_ != constants::item::stackingStyle::ALLOW_ALL)
         {
             Bin::itemsWithStackingStyle_.push_back(it);
         };
@@ -65,5 +65,14 @@ public:
         return resultIterator != BinCalculationCache::intersectionLimits_.end() &&
                aItemToBeFound->smallestDimension_ >= resultIterator->second;
     };
+
+    /**
+     * @brief Drop all cached intersections and free the memory of the cache.
+     *
+     */
+    void clearIntersections()
+    {
+        decltype(BinCalculationCache::intersectionLimits_)().swap(BinCalculationCache::intersectionLimits_);
+    };
 };
 #endif
\ No newline at end of file
@@ -12,8 +12,14 @@ private:
     std::vector<std::shared_ptr<RequestedBin>> requestedBins_;
     std::vector<std::shared_ptr<Bin>> packedBins_;
     std::shared_ptr<ItemRegister> masterItemRegister_;
+    StringRegister binTypes_;
     std::vector<int> itemsToBePacked_;
+    std::vector<uint64_t> compatibleBinMasks_;
+    int compatibleBinMaskWords_;
+    std::shared_ptr<FeasibilityIndex> feasibilityIndex_;
     int minimizationStrategy_;
+    int maxNrOfItemsPerShard_;
+    std::shared_ptr<ThreadBudget> threadBudget_;
 
     void setMinimizationStrategy(const int aStrategy)
     {
@@ -25,6 +31,10 @@ private:
         {
             BinComposer::minimizationStrategy_ = constants::binComposer::minimizationStrategy::STRICT_BINS;
         }
+        else if (constants::binComposer::minimizationStrategy::PLANNED == aStrategy)
+        {
+            BinComposer::minimizationStrategy_ = constants::binComposer::minimizationStrategy::PLANNED;
+        }
         else
         {
             BinComposer::minimizationStrategy_ = constants::binComposer::minimizationStrategy::VOLUME;
@@ -50,7 +60,7 @@ private:
         int binIndex = 0;
         for (int idx = BinComposer::requestedBins_.size(); idx--;)
         {
-            if (BinComposer::requestedBins_[idx]->getType() == aRequestedBin->getType())
+            if (BinComposer::requestedBins_[idx]->getTypeId() == aRequestedBin->getTypeId())
             {
                 binFound = true;
                 binIndex = idx;
@@ -64,12 +74,38 @@ private:
     }
 
 public:
-    BinComposer(std::shared_ptr<ItemRegister> aItemRegister, int aMinimizationStrategy) : masterItemRegister_(aItemRegister)
+    BinComposer(std::shared_ptr<ItemRegister> aItemRegister,
+                int aMinimizationStrategy,
+                const int aMaxNrOfThreads = DEFAULT_MAX_THREADS_PER_REQUEST,
+                const int aMaxNrOfItemsPerShard = DEFAULT_MAX_NR_OF_ITEMS_PER_SHARD) : masterItemRegister_(aItemRegister),
+                                                                                      compatibleBinMaskWords_(0),
+                                                                                      maxNrOfItemsPerShard_(std::max(aMaxNrOfItemsPerShard, 0)),
+                                                                                      threadBudget_(std::make_shared<ThreadBudget>(aMaxNrOfThreads))
     {
         BinComposer::mixedBinPackerHandler_ = std::make_shared<MixedBinPackerHandler>();
         BinComposer::setMinimizationStrategy(aMinimizationStrategy);
     };
 
+    /**
+     * @brief Create a bin composer for a shard, it packs the given items with the requested bins and settings of the parent.
+     *
+     * The parent must have started packing, the shard shares its item register, feasibility index and thread budget.
+     *
+     * @param aParent
+     * @param aItemKeys
+     */
+    BinComposer(const BinComposer &aParent, const std::vector<int> &aItemKeys) : mixedBinPackerHandler_(aParent.mixedBinPackerHandler_),
+                                                                                 requestedBins_(aParent.requestedBins_),
+                                                                                 masterItemRegister_(aParent.masterItemRegister_),
+                                                                                 binTypes_(aParent.binTypes_),
+                                                                                 itemsToBePacked_(aItemKeys),
+                                                                                 compatibleBinMasks_(aParent.compatibleBinMasks_),
+                                                                                 compatibleBinMaskWords_(aParent.compatibleBinMaskWords_),
+                                                                                 feasibilityIndex_(aParent.feasibilityIndex_),
+                                                                                 minimizationStrategy_(aParent.minimizationStrategy_),
+                                                                                 maxNrOfItemsPerShard_(0),
+                                                                                 threadBudget_(aParent.threadBudget_){};
+
     void addItem(const int aItemKey) { BinComposer::itemsToBePacked_.push_back(aItemKey); };
     const std::vector<int> &getItemsToBePacked() { return BinComposer::itemsToBePacked_; };
     const int getNumberOfBins() const { return (int)BinComposer::packedBins_.size(); };
@@ -77,12 +113,14 @@ public:
 
     void addRequestedBin(const std::shared_ptr<RequestedBin> aRequestedBin)
     {
+        aRequestedBin->setTypeId(BinComposer::binTypes_.getId(aRequestedBin->getType()));
         BinComposer::requestedBins_.push_back(aRequestedBin);
         BinComposer::sortRequestedBinsOnVolume();
     };
 
     void addPackedBin(std::shared_ptr<Bin> aBin)
     {
+        aBin->compactToResult();
         aBin->id_ = (int)BinComposer::packedBins_.size() + 1;
         BinComposer::packedBins_.push_back(aBin);
 
@@ -98,7 +136,7 @@ public:
         {
             for (const int item : bin->getFittedItems())
             {
-                totalItemVolume += BinComposer::masterItemRegister_->getConstItem(item)->getRealVolume();
+                totalItemVolume += BinComposer::masterItemRegister_->peekItem(item)->getRealVolume();
             };
             totalAvailableVolume += bin->getRealVolume();
         };
@@ -115,7 +153,7 @@ public:
         {
             for (const int item : bin->getFittedItems())
             {
-                totalItemWeight += BinComposer::masterItemRegister_->getConstItem(item)->getRealWeight();
+                totalItemWeight += BinComposer::masterItemRegister_->peekItem(item)->getRealWeight();
             };
 
             totalAvailableWeight += bin->getRealMaxWeight();
@@ -132,53 +170,123 @@ public:
     std::shared_ptr<ItemRegister> getMasterItemRegister() { return BinComposer::masterItemRegister_; };
 
     /**
-     * @brief Get the items which will never fit in any bin.
+     * @brief Get one item type per item type id of the items to be packed, ids without items to be packed hold a nullptr.
      *
-     * @return const std::vector<int>
+     * @return const std::vector<std::shared_ptr<Item>>
      */
-    const std::vector<int> getItemsWhichWillNeverFit()
+    const std::vector<std::shared_ptr<Item>> getItemTypesToBePacked() const
     {
-        std::vector<int> itemsWhichWillNeverFit = {};
+        std::vector<std::shared_ptr<Item>> itemTypes(BinComposer::masterItemRegister_->getNumberOfItemTypes());
 
         for (const int aItemKeyToBePacked : BinComposer::itemsToBePacked_)
         {
-            bool canFit = false;
+            const std::shared_ptr<Item> &itemType = BinComposer::masterItemRegister_->getItemType(aItemKeyToBePacked);
+            if (!itemTypes[itemType->Item::itemTypeId_])
+            {
+                itemTypes[itemType->Item::itemTypeId_] = itemType;
+            };
+        };
+
+        return itemTypes;
+    }
 
-            const std::shared_ptr<Item> itemToFit = BinComposer::getMasterItemRegister()->getConstItem(aItemKeyToBePacked);
+    /**
+     * @brief Build the item type x bin type bitmask of the compatible bins of the item types.
+     *
+     * Items without compatible bins are compatible with every requested bin, bin types which were not requested are ignored.
+     *
+     * @param aItemTypes
+     */
+    void setCompatibleBinMasks(const std::vector<std::shared_ptr<Item>> &aItemTypes)
+    {
+        BinComposer::compatibleBinMaskWords_ = BinComposer::binTypes_.size() / 64 + 1;
+        BinComposer::compatibleBinMasks_.assign(aItemTypes.size() * BinComposer::compatibleBinMaskWords_, 0);
 
-            for (const std::shared_ptr<RequestedBin> requestedBin : BinComposer::requestedBins_)
+        for (const std::shared_ptr<Item> &itemType : aItemTypes)
+        {
+            if (!itemType)
             {
+                continue;
+            };
 
-                if (canFit)
-                {
-                    break;
-                }
+            uint64_t *compatibleBinMask = &BinComposer::compatibleBinMasks_[(size_t)itemType->Item::itemTypeId_ * BinComposer::compatibleBinMaskWords_];
+            std::vector<int> compatibleBinTypeIds;
 
-                if (itemToFit->weight_ > requestedBin->getMaxWeight())
+            if (itemType->Item::compatibleBins_.empty())
+            {
+                for (const std::shared_ptr<RequestedBin> &requestedBin : BinComposer::requestedBins_)
                 {
-                    continue;
+                    compatibleBinTypeIds.push_back(requestedBin->getTypeId());
                 };
+            }
+            else
+            {
+                for (const std::string &compatibleBin : itemType->Item::compatibleBins_)
+                {
+                    compatibleBinTypeIds.push_back(BinComposer::binTypes_.findId(compatibleBin));
+                };
+            };
 
-                for (int stringCharCounter = 0; stringCharCounter < itemToFit->Item::allowedRotations_.std::string::size(); stringCharCounter++)
+            for (const int binTypeId : compatibleBinTypeIds)
+            {
+                if (binTypeId >= 0)
                 {
-                    itemToFit->Item::rotate(itemToFit->Item::allowedRotations_[stringCharCounter] - '0');
+                    compatibleBinMask[binTypeId / 64] |= uint64_t(1) << (binTypeId % 64);
+                };
+            };
+        };
+    }
 
-                    /* Check if item is not exceeding the bin dimensions, if so try a different rotation. */
-                    if (requestedBin->getWidth() < itemToFit->Item::furthestPointWidth_ ||
-                        requestedBin->getDepth() < itemToFit->Item::furthestPointDepth_ ||
-                        requestedBin->getHeight() < itemToFit->Item::furthestPointHeight_)
-                    {
-                        continue;
-                    }
+    /**
+     * @brief Checks if an item type may be packed in a requested bin.
+     *
+     * @param aItemType
+     * @param aRequestedBin
+     * @return const bool
+     */
+    const bool isCompatible(const std::shared_ptr<Item> &aItemType, const std::shared_ptr<RequestedBin> &aRequestedBin) const
+    {
+        const int binTypeId = aRequestedBin->getTypeId();
+        return (BinComposer::compatibleBinMasks_[(size_t)aItemType->Item::itemTypeId_ * BinComposer::compatibleBinMaskWords_ + binTypeId / 64] >> (binTypeId % 64)) & 1;
+    }
 
-                    canFit = true;
-                    break;
-                };
-            }
+    /**
+     * @brief Checks if an item type is compatible with a requested bin and fits in it in one of its allowed rotations.
+     *
+     * @param aItemType
+     * @param aRequestedBin
+     * @return const bool
+     */
+    const bool canBePackedIn(const std::shared_ptr<Item> &aItemType, const std::shared_ptr<RequestedBin> &aRequestedBin) const
+    {
+        return BinComposer::isCompatible(aItemType, aRequestedBin) &&
+               BinComposer::feasibilityIndex_->fits(aItemType->Item::itemTypeId_, aRequestedBin->getTypeId());
+    }
+
+    /**
+     * @brief Get the items which will never fit in any bin.
+     *
+     * Evaluated once per item type, all units of an item type share the result.
+     *
+     * @return const std::vector<int>
+     */
+    const std::vector<int> getItemsWhichWillNeverFit() const
+    {
+        std::vector<int> itemsWhichWillNeverFit = {};
+        std::vector<int> itemTypeFits(BinComposer::masterItemRegister_->getNumberOfItemTypes(), -1);
+
+        for (const int aItemKeyToBePacked : BinComposer::itemsToBePacked_)
+        {
+            const std::shared_ptr<Item> &itemType = BinComposer::masterItemRegister_->getItemType(aItemKeyToBePacked);
+            int &fits = itemTypeFits[itemType->Item::itemTypeId_];
 
-            itemToFit->reset();
+            if (fits < 0)
+            {
+                fits = std::any_of(BinComposer::requestedBins_.begin(), BinComposer::requestedBins_.end(), [this, &itemType](const std::shared_ptr<RequestedBin> &requestedBin)
+                                   { return BinComposer::canBePackedIn(itemType, requestedBin); });
+            };
 
-            if (!canFit)
+            if (!fits)
             {
                 itemsWhichWillNeverFit.push_back(aItemKeyToBePacked);
             }
@@ -187,60 +295,92 @@ public:
         return itemsWhichWillNeverFit;
     };
 
-    void startPacking()
+    /**
+     * @brief Get the score a bin of the requested bin adds to a packer, the same value getWinningPacker compares packers on.
+     *
+     * STRICT_BINS compares the utilization of the winning bin, which is not known while packing, so it has no score.
+     *
+     * @param aRequestedBin
+     * @return const double
+     */
+    const double getScorePerBin(const std::shared_ptr<RequestedBin> &aRequestedBin) const
     {
-        // Remove items which will never fit and add them back after packing is done..
-        std::vector<int> itemsWhichWillNeverFit = BinComposer::getItemsWhichWillNeverFit();
-        BinComposer::itemsToBePacked_ = BinComposer::mixedBinPackerHandler_->removeDuplicateIntegers(BinComposer::itemsToBePacked_, itemsWhichWillNeverFit);
-        BinComposer::compose();
-        BinComposer::itemsToBePacked_.insert(BinComposer::itemsToBePacked_.end(), itemsWhichWillNeverFit.begin(), itemsWhichWillNeverFit.end());
+        return BinComposer::minimizationStrategy_ == constants::binComposer::minimizationStrategy::BINS ? 1 : aRequestedBin->getMaxVolume();
     }
 
     /**
-     * @brief Start constructing winning bins.
+     * @brief Create a packer for the requested bin with the items that can be packed in it.
      *
+     * @param aRequestedBin
+     * @param aItemKeys
+     * @return std::shared_ptr<Packer>
      */
-    void compose()
+    std::shared_ptr<Packer> createPacker(const std::shared_ptr<RequestedBin> &aRequestedBin, const std::vector<int> &aItemKeys) const
     {
-
-        if (BinComposer::itemsToBePacked_.empty())
-        {
-            return;
-        }
-
-        std::vector<std::shared_ptr<Packer>> processedPackers;
-
-        // Execute packing for each requestedbin size.
-        for (std::shared_ptr<RequestedBin> requestedBin : BinComposer::requestedBins_)
+        std::shared_ptr<ItemRegister> itemRegister = std::make_shared<ItemRegister>(aRequestedBin->getItemSortMethod(), (int)aItemKeys.size());
+        int nrOfExcludedItems = 0;
+        for (const int aItemKeyToBePacked : aItemKeys)
         {
+            const std::shared_ptr<Item> &itemType = BinComposer::masterItemRegister_->getItemType(aItemKeyToBePacked);
 
-            std::shared_ptr<ItemRegister> itemRegister = std::make_shared<ItemRegister>(requestedBin->getItemSortMethod(), (int)BinComposer::itemsToBePacked_.size());
-            for (const int aItemKeyToBePacked : BinComposer::itemsToBePacked_)
+            // Items which may not be packed in this bin, or never fit in it, are not seen by its packer.
+            if (!BinComposer::canBePackedIn(itemType, aRequestedBin))
             {
-                std::shared_ptr<Item> copiedItem = std::make_shared<Item>(*BinComposer::getMasterItemRegister()->getConstItem(aItemKeyToBePacked));
-                itemRegister->addItem(copiedItem);
+                nrOfExcludedItems++;
+                continue;
             };
 
-            std::shared_ptr<Gravity> masterGravity = std::make_shared<Gravity>(requestedBin->getBinGravityStrength(), itemRegister);
-            std::shared_ptr<Packer> packingProcessor = std::make_shared<Packer>(std::make_shared<PackingContext>(masterGravity, itemRegister, requestedBin));
+            itemRegister->addItem(aItemKeyToBePacked, itemType);
+        };
 
-            for (std::vector<int> sortedItemConsKeyVector : packingProcessor->getContext()->getItemRegister()->getNewSortedItemKeys())
-            {
-                packingProcessor->startPackingCluster(sortedItemConsKeyVector);
-            };
+        std::shared_ptr<Gravity> masterGravity = std::make_shared<Gravity>(aRequestedBin->getBinGravityStrength(), itemRegister);
+        std::shared_ptr<Packer> packer = std::make_shared<Packer>(std::make_shared<PackingContext>(masterGravity, itemRegister, aRequestedBin));
+        packer->getContext()->setThreadBudget(BinComposer::threadBudget_);
+        packer->setNumberOfExcludedItems(nrOfExcludedItems);
+        return packer;
+    }
 
-            processedPackers.push_back(packingProcessor);
-        };
+    /**
+     * @brief Pack the items in the given order into a single bin of a packer of their own and return that bin.
+     *
+     * The packer stops before it opens a second bin, the items which do not fit are left out.
+     * The packer has its own item register, so the items in the bins of other packers keep their positions.
+     * Sort method cannot be OPTIMIZED since OPTIMIZED does not have to take into account the order of the items.
+     *
+     * @param aRequestedBin
+     * @param aItemKeys
+     * @return std::shared_ptr<Bin>
+     */
+    std::shared_ptr<Bin> repackBin(const std::shared_ptr<RequestedBin> &aRequestedBin, const std::vector<int> &aItemKeys) const
+    {
+        std::shared_ptr<Packer> packer = BinComposer::createPacker(aRequestedBin, aItemKeys);
+        packer->getContext()->setMaxNrOfBins(1);
+        packer->getContext()->getItemRegister()->setSortMethodHelper(constants::itemRegister::parameter::sortMethod::VOLUME);
+        packer->startPackingCluster(aItemKeys);
+        return BinComposer::mixedBinPackerHandler_->getWinningBin(packer);
+    }
 
+    /**
+     * @brief Find the winning packer according to the minimization strategy.
+     *
+     * Packers with unfitted items cannot win. Packers which did not see all items, because some are not compatible with their bin or never fit in it,
+     * can only win if aAllowExcludedItems is set.
+     *
+     * @param aProcessedPackers
+     * @param aAllowExcludedItems
+     * @return std::shared_ptr<Packer>
+     */
+    std::shared_ptr<Packer> getWinningPacker(const std::vector<std::shared_ptr<Packer>> &aProcessedPackers, const bool aAllowExcludedItems) const
+    {
         std::shared_ptr<Packer> winningPacker;
         double winningPackerValue = 0;
         // Evaluate the packing results and find the winning bin.
-        for (const std::shared_ptr<Packer> processedPacker : processedPackers)
+        for (const std::shared_ptr<Packer> processedPacker : aProcessedPackers)
         {
             double processedPackerValue = 0;
 
             // Not all items can be fitted, skip to bigger bin in order to pack these items. This works because the items which can never fit have been removed previously.
-            if (processedPacker->hasUnfittedItems())
+            if (processedPacker->isCancelled() || processedPacker->hasUnfittedItems() || (!aAllowExcludedItems && processedPacker->hasExcludedItems()))
             {
                 continue;
             }
@@ -294,35 +434,422 @@ public:
             };
         }
 
+        return winningPacker;
+    }
+
+    void startPacking()
+    {
+        BinComposer::masterItemRegister_->orderItemConsolidationKeys();
+        const std::vector<std::shared_ptr<Item>> itemTypes = BinComposer::getItemTypesToBePacked();
+        BinComposer::setCompatibleBinMasks(itemTypes);
+        BinComposer::feasibilityIndex_ = std::make_shared<FeasibilityIndex>(itemTypes, BinComposer::requestedBins_, BinComposer::binTypes_.size());
+
+        // Remove items which will never fit and add them back after packing is done..
+        std::vector<int> itemsWhichWillNeverFit = BinComposer::getItemsWhichWillNeverFit();
+        BinComposer::itemsToBePacked_ = BinComposer::mixedBinPackerHandler_->removeDuplicateIntegers(BinComposer::itemsToBePacked_, itemsWhichWillNeverFit);
+        if (BinComposer::usesShards())
+        {
+            BinComposer::composeShards(itemTypes);
+        }
+        else
+        {
+            BinComposer::composeItems(itemTypes);
+        };
+        BinComposer::itemsToBePacked_.insert(BinComposer::itemsToBePacked_.end(), itemsWhichWillNeverFit.begin(), itemsWhichWillNeverFit.end());
+    }
+
+    /**
+     * @brief Pack the items to be packed according to the minimization strategy.
+     *
+     * @param aItemTypes item types indexed by item type id.
+     */
+    void composeItems(const std::vector<std::shared_ptr<Item>> &aItemTypes)
+    {
+        if (BinComposer::minimizationStrategy_ == constants::binComposer::minimizationStrategy::PLANNED)
+        {
+            BinComposer::composePlanned(aItemTypes);
+        }
+        else
+        {
+            BinComposer::compose();
+        };
+    }
+
+    /**
+     * @brief Checks if the items are split into shards.
+     *
+     * STRICT_BINS uses every requested bin once for the whole request, which shards packed on their own can not respect.
+     *
+     * @return true
+     * @return false
+     */
+    const bool usesShards() const
+    {
+        return BinComposer::maxNrOfItemsPerShard_ > 0 &&
+               (int)BinComposer::itemsToBePacked_.size() > BinComposer::maxNrOfItemsPerShard_ &&
+               BinComposer::minimizationStrategy_ != constants::binComposer::minimizationStrategy::STRICT_BINS;
+    }
+
+    /**
+     * @brief Split the items to be packed into shards of at most the maximum number of items per shard.
+     *
+     * Only items with the same item consolidation key which can be packed in the same requested bins go in one shard.
+     * A group with too many items is split in equal shards, its items are dealt largest first so every shard gets the same mix of sizes.
+     *
+     * @return const std::vector<std::vector<int>>
+     */
+    const std::vector<std::vector<int>> getShards() const
+    {
+        std::vector<int> binSetIdPerItemType(BinComposer::masterItemRegister_->getNumberOfItemTypes(), -1);
+        std::map<std::vector<bool>, int> binSetIds;
+        std::map<std::pair<int, int>, std::vector<int>> itemKeysPerGroup;
+
+        for (const int itemKey : BinComposer::itemsToBePacked_)
+        {
+            const std::shared_ptr<Item> &itemType = BinComposer::masterItemRegister_->getItemType(itemKey);
+            int &binSetId = binSetIdPerItemType[itemType->Item::itemTypeId_];
+            if (binSetId < 0)
+            {
+                std::vector<bool> binSet;
+                for (const std::shared_ptr<RequestedBin> &requestedBin : BinComposer::requestedBins_)
+                {
+                    binSet.push_back(BinComposer::canBePackedIn(itemType, requestedBin));
+                };
+                binSetId = binSetIds.emplace(binSet, (int)binSetIds.size()).first->second;
+            };
+
+            itemKeysPerGroup[{BinComposer::masterItemRegister_->peekItem(itemKey)->itemConsolidationKeyId_, binSetId}].push_back(itemKey);
+        };
+
+        std::vector<std::vector<int>> shards;
+        for (std::pair<const std::pair<int, int>, std::vector<int>> &group : itemKeysPerGroup)
+        {
+            std::vector<int> &itemKeys = group.second;
+            const int nrOfShards = ((int)itemKeys.size() + BinComposer::maxNrOfItemsPerShard_ - 1) / BinComposer::maxNrOfItemsPerShard_;
+            if (nrOfShards == 1)
+            {
+                shards.push_back(itemKeys);
+                continue;
+            };
+
+            std::stable_sort(itemKeys.begin(), itemKeys.end(), [this](const int itemKeyLeft, const int itemKeyRight)
+                             { return BinComposer::masterItemRegister_->peekItem(itemKeyLeft)->Item::volume_ > BinComposer::masterItemRegister_->peekItem(itemKeyRight)->Item::volume_; });
+
+            const int firstShard = (int)shards.size();
+            shards.resize(firstShard + nrOfShards);
+            for (int idx = 0; idx < (int)itemKeys.size(); idx++)
+            {
+                shards[firstShard + idx % nrOfShards].push_back(itemKeys[idx]);
+            };
+        };
+
+        return shards;
+    }
+
+    /**
+     * @brief Get the score of packed bins according to the minimization strategy, lower is better.
+     *
+     * @param aPackedBins
+     * @return const double
+     */
+    const double getScore(const std::vector<std::shared_ptr<Bin>> &aPackedBins) const
+    {
+        double score = 0;
+        for (const std::shared_ptr<Bin> &packedBin : aPackedBins)
+        {
+            score += BinComposer::minimizationStrategy_ == constants::binComposer::minimizationStrategy::BINS ? 1 : packedBin->getRealVolume();
+        };
+        return score;
+    }
+
+    /**
+     * @brief Pack the items shard by shard, the shards are packed at the same time within the thread budget.
+     *
+     * The last bin of a shard is its least filled bin. The last bins of all shards and the items the shards left are packed
+     * together once more, the result replaces the last bins if it leaves fewer items or scores better.
+     *
+     * @param aItemTypes item types indexed by item type id.
+     */
+    void composeShards(const std::vector<std::shared_ptr<Item>> &aItemTypes)
+    {
+        std::vector<std::shared_ptr<BinComposer>> shardComposers;
+        for (const std::vector<int> &shard : BinComposer::getShards())
+        {
+            shardComposers.push_back(std::make_shared<BinComposer>(*this, shard));
+        };
+
+        auto packShard = [&shardComposers, &aItemTypes](const int aShardIndex)
+        {
+            shardComposers[aShardIndex]->composeItems(aItemTypes);
+        };
+        TaskScheduler::parallelFor((int)shardComposers.size(), *BinComposer::threadBudget_, packShard);
+
+        std::vector<std::shared_ptr<Bin>> packedBins;
+        std::vector<std::shared_ptr<Bin>> tailBins;
+        std::vector<int> tailItems;
+        std::vector<int> unfittedItems;
+        for (const std::shared_ptr<BinComposer> &shardComposer : shardComposers)
+        {
+            const std::vector<std::shared_ptr<Bin>> &shardBins = shardComposer->packedBins_;
+            if (!shardBins.empty())
+            {
+                packedBins.insert(packedBins.end(), shardBins.begin(), shardBins.end() - 1);
+                tailBins.push_back(shardBins.back());
+                tailItems.insert(tailItems.end(), shardBins.back()->getFittedItems().begin(), shardBins.back()->getFittedItems().end());
+            };
+            unfittedItems.insert(unfittedItems.end(), shardComposer->itemsToBePacked_.begin(), shardComposer->itemsToBePacked_.end());
+        };
+        shardComposers.clear();
+
+        tailItems.insert(tailItems.end(), unfittedItems.begin(), unfittedItems.end());
+        BinComposer tailComposer(*this, tailItems);
+        tailComposer.composeItems(aItemTypes);
+
+        if (tailComposer.itemsToBePacked_.size() < unfittedItems.size() ||
+            (tailComposer.itemsToBePacked_.size() == unfittedItems.size() && BinComposer::getScore(tailComposer.packedBins_) < BinComposer::getScore(tailBins)))
+        {
+            tailBins = tailComposer.packedBins_;
+            unfittedItems = tailComposer.itemsToBePacked_;
+        };
+
+        packedBins.insert(packedBins.end(), tailBins.begin(), tailBins.end());
+        for (int idx = 0; idx < (int)packedBins.size(); idx++)
+        {
+            packedBins[idx]->id_ = idx + 1;
+        };
+
+        BinComposer::packedBins_ = packedBins;
+        BinComposer::itemsToBePacked_ = unfittedItems;
+    }
+
+    /**
+     * @brief Plan the number of bins per requested bin that takes the items.
+     *
+     * The number of bins a requested bin needs on its own is estimated by the largest of its volume, weight and item limit bounds
+     * and the homogeneous layer count of every single item type. The estimate is low rather than high, planning again after every bin repairs it.
+     * Bins already packed count against the available bins of their type.
+     *
+     * @param aItemTypes item types indexed by item type id.
+     * @param aItemKeys
+     * @param aUsableRequestedBins requested bins which may be planned, indexed like requestedBins_.
+     * @return const std::vector<int> number of bins per requested bin, empty if no plan was found.
+     */
+    const std::vector<int> planBinMix(const std::vector<std::shared_ptr<Item>> &aItemTypes,
+                                      const std::vector<int> &aItemKeys,
+                                      const std::vector<bool> &aUsableRequestedBins) const
+    {
+        std::vector<int> nrOfItemsPerItemType(aItemTypes.size(), 0);
+        for (const int itemKey : aItemKeys)
+        {
+            nrOfItemsPerItemType[BinComposer::masterItemRegister_->getItemType(itemKey)->itemTypeId_]++;
+        };
+
+        BinMixPlanner planner;
+        for (int idx = 0; idx < (int)BinComposer::requestedBins_.size(); idx++)
+        {
+            const std::shared_ptr<RequestedBin> &requestedBin = BinComposer::requestedBins_[idx];
+
+            // Bins of this type which are already packed are no longer available.
+            int nrOfAvailableBins = requestedBin->getNrOfAvailableBins();
+            for (const std::shared_ptr<Bin> &packedBin : BinComposer::packedBins_)
+            {
+                if (requestedBin->getNrOfAvailableBins() > 0 && packedBin->type_ == requestedBin->getType())
+                {
+                    nrOfAvailableBins--;
+                };
+            };
+            const bool usable = aUsableRequestedBins[idx] && (requestedBin->getNrOfAvailableBins() == 0 || nrOfAvailableBins > 0);
+
+            double volume = 0;
+            double weight = 0;
+            int nrOfItems = 0;
+            double estimatedNrOfBins = 0;
+            for (int itemTypeId = 0; itemTypeId < (int)aItemTypes.size() && usable; itemTypeId++)
+            {
+                if (nrOfItemsPerItemType[itemTypeId] > 0 && BinComposer::canBePackedIn(aItemTypes[itemTypeId], requestedBin))
+                {
+                    volume += nrOfItemsPerItemType[itemTypeId] * aItemTypes[itemTypeId]->getRealVolume();
+                    weight += nrOfItemsPerItemType[itemTypeId] * aItemTypes[itemTypeId]->Item::weight_;
+                    nrOfItems += nrOfItemsPerItemType[itemTypeId];
+                    estimatedNrOfBins = std::max(estimatedNrOfBins, (double)nrOfItemsPerItemType[itemTypeId] / BinMixPlanner::getHomogeneousCapacity(aItemTypes[itemTypeId], requestedBin));
+                };
+            };
+
+            estimatedNrOfBins = std::max(estimatedNrOfBins, volume / requestedBin->getMaxVolume());
+            if (requestedBin->getMaxWeight() > 0)
+            {
+                estimatedNrOfBins = std::max(estimatedNrOfBins, weight / requestedBin->getMaxWeight());
+            };
+            if (requestedBin->getItemLimit() > 0)
+            {
+                estimatedNrOfBins = std::max(estimatedNrOfBins, (double)nrOfItems / requestedBin->getItemLimit());
+            };
+
+            planner.addBinType(estimatedNrOfBins, requestedBin->getMaxVolume(), nrOfAvailableBins);
+        };
+
+        return planner.plan();
+    }
+
+    /**
+     * @brief Plan the bin mix first, then pack the largest planned bin once and plan again for the items left.
+     *
+     * Items with a different item consolidation key never share a bin, so every item consolidation key is planned on its own.
+     * Every packed bin costs a single bin pack instead of a full pack per requested bin.
+     * Items the planned bins do not take are packed by compose.
+     *
+     * @param aItemTypes item types indexed by item type id.
+     */
+    void composePlanned(const std::vector<std::shared_ptr<Item>> &aItemTypes)
+    {
+        std::map<int, std::vector<int>> itemKeysPerConsKey;
+        for (const int itemKey : BinComposer::itemsToBePacked_)
+        {
+            itemKeysPerConsKey[BinComposer::masterItemRegister_->peekItem(itemKey)->itemConsolidationKeyId_].push_back(itemKey);
+        };
+
+        for (std::pair<const int, std::vector<int>> &consKeyItemKeys : itemKeysPerConsKey)
+        {
+            std::vector<int> &itemKeys = consKeyItemKeys.second;
+            std::vector<bool> usableRequestedBins(BinComposer::requestedBins_.size(), true);
+
+            while (!itemKeys.empty())
+            {
+                const std::vector<int> plannedBins = BinComposer::planBinMix(aItemTypes, itemKeys, usableRequestedBins);
+
+                // Requested bins are sorted smallest first, the smaller planned bins take the items left by the larger ones.
+                int idx = (int)plannedBins.size();
+                while (idx-- && plannedBins[idx] == 0)
+                {
+                };
+
+                if (idx < 0)
+                {
+                    break;
+                };
+
+                // The packer stops before it opens a second bin.
+                std::shared_ptr<Packer> packer = BinComposer::createPacker(BinComposer::requestedBins_[idx], itemKeys);
+                packer->getContext()->setMaxNrOfBins(1);
+
+                for (const std::vector<int> &sortedItemConsKeyVector : packer->getContext()->getItemRegister()->getNewSortedItemKeys())
+                {
+                    packer->startPackingCluster(sortedItemConsKeyVector);
+                };
+
+                if (packer->getBins().empty())
+                {
+                    usableRequestedBins[idx] = false;
+                    continue;
+                };
+
+                const std::shared_ptr<Bin> packedBin = packer->getBins().front();
+                ItemSet(packedBin->getFittedItems()).removeFrom(itemKeys);
+                BinComposer::addPackedBin(packedBin);
+            };
+        };
+
+        // Repair, items which did not fit in the planned bins are packed the greedy way.
+        BinComposer::compose();
+    }
+
+    /**
+     * @brief Start constructing winning bins.
+     *
+     */
+    void compose()
+    {
+
+        if (BinComposer::itemsToBePacked_.empty())
+        {
+            return;
+        }
+
+        std::vector<std::shared_ptr<Packer>> processedPackers;
+
+        // Packers which can no longer beat a packer that already took all items stop early.
+        std::shared_ptr<IncumbentScore> incumbentScore;
+        if (BinComposer::minimizationStrategy_ != constants::binComposer::minimizationStrategy::STRICT_BINS)
+        {
+            incumbentScore = std::make_shared<IncumbentScore>();
+        };
+
+        // Execute packing for each requestedbin size, the rank of a packer is its index so ties resolve as if packed in order.
+        for (std::shared_ptr<RequestedBin> requestedBin : BinComposer::requestedBins_)
+        {
+            std::shared_ptr<Packer> packingProcessor = BinComposer::createPacker(requestedBin, BinComposer::itemsToBePacked_);
+            packingProcessor->getContext()->setIncumbentScore(incumbentScore, BinComposer::getScorePerBin(requestedBin), (int)processedPackers.size());
+            processedPackers.push_back(packingProcessor);
+        };
+
+        // Packers only share read only item types and the incumbent score, so they can pack at the same time.
+        auto packRequestedBin = [this, &processedPackers, &incumbentScore](const int aPackerIndex)
+        {
+            const std::shared_ptr<Packer> &packingProcessor = processedPackers[aPackerIndex];
+            for (const std::vector<int> &sortedItemConsKeyVector : packingProcessor->getContext()->getItemRegister()->getNewSortedItemKeys())
+            {
+                packingProcessor->startPackingCluster(sortedItemConsKeyVector);
+            };
+
+            if (incumbentScore && !packingProcessor->isCancelled() && !packingProcessor->hasUnfittedItems() &&
+                !packingProcessor->hasExcludedItems() && packingProcessor->getNumberOfBins() > 0)
+            {
+                incumbentScore->offer(packingProcessor->getNumberOfBins() * BinComposer::getScorePerBin(packingProcessor->getContext()->getRequestedBin()), aPackerIndex);
+            };
+        };
+        TaskScheduler::parallelFor((int)processedPackers.size(), *BinComposer::threadBudget_, packRequestedBin);
+
+        std::shared_ptr<Packer> winningPacker = BinComposer::getWinningPacker(processedPackers, false);
+
+        // No packer could take all items, let the packers which fitted all items they were given compete.
+        if (!winningPacker)
+        {
+            winningPacker = BinComposer::getWinningPacker(processedPackers, true);
+        };
+
         // No items were fitted.
         if (!winningPacker)
         {
             return;
         };
 
-        std::vector<int> fittedItems = BinComposer::mixedBinPackerHandler_->getWinningBin(winningPacker)->getFittedItems();
-        const std::string consolidationKeyOfFittedItems = BinComposer::masterItemRegister_->getConstItem(fittedItems.front())->itemConsolidationKey_;
+        std::shared_ptr<Bin> winningBin = BinComposer::mixedBinPackerHandler_->getWinningBin(winningPacker);
+        std::vector<int> fittedItems = winningBin->getFittedItems();
+        const int consolidationKeyOfFittedItems = BinComposer::masterItemRegister_->peekItem(fittedItems.front())->itemConsolidationKeyId_;
 
-        // Sort method cannot be OPTIMIZED since OPTIMIZED does not have to take into account the order of items in the sortedItemConsKeyVector.
-        // but we rely on this order to make sure the new bin is the same as the old bin.
+        // Items of the same item consolidation key that are not in the winning bin are tried on top of its items, largest first.
         winningPacker->getContext()->getItemRegister()->setSortMethodHelper(constants::itemRegister::parameter::sortMethod::VOLUME);
         std::vector<int> sortedItemConsKeyVector = winningPacker->getContext()->getItemRegister()->getNewSortedItemKeysForKey(consolidationKeyOfFittedItems);
 
         // If these are equal, then nothing new can be packed.
         if ((int)sortedItemConsKeyVector.size() > (int)fittedItems.size())
         {
-            sortedItemConsKeyVector = BinComposer::mixedBinPackerHandler_->removeDuplicateIntegers(sortedItemConsKeyVector, fittedItems);
-            fittedItems.insert(fittedItems.end(), sortedItemConsKeyVector.begin(), sortedItemConsKeyVector.end());
-            winningPacker->startPackingCluster(fittedItems);
+            ItemSet(fittedItems).removeFrom(sortedItemConsKeyVector);
+            if (!winningBin->addItems(sortedItemConsKeyVector))
+            {
+                // Items were left out, packing a single bin from scratch with them can find a tighter layout. The fuller bin is kept.
+                fittedItems.insert(fittedItems.end(), sortedItemConsKeyVector.begin(), sortedItemConsKeyVector.end());
+                const std::shared_ptr<Bin> repackedBin = BinComposer::repackBin(winningPacker->getContext()->getRequestedBin(), fittedItems);
+                if (repackedBin->getRealActualVolumeUtilPercentage() > winningBin->getRealActualVolumeUtilPercentage())
+                {
+                    winningBin = repackedBin;
+                };
+            };
         };
 
-        BinComposer::addPackedBin(BinComposer::mixedBinPackerHandler_->getWinningBin(winningPacker));
+        BinComposer::addPackedBin(winningBin);
+
+        // The packers of this round are done, free them before packing the next bin.
+        const std::shared_ptr<RequestedBin> winningRequestedBin = winningPacker->getContext()->getRequestedBin();
+        winningBin.reset();
+        winningPacker.reset();
+        processedPackers.clear();
 
         if (!BinComposer::itemsToBePacked_.empty())
         {
             if (BinComposer::minimizationStrategy_ == constants::binComposer::minimizationStrategy::STRICT_BINS)
             {
-                BinComposer::removeRequestedBin(winningPacker->getContext()->getRequestedBin());
+                BinComposer::removeRequestedBin(winningRequestedBin);
             };
 
             BinComposer::compose();
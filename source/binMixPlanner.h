@@ -0,0 +1,153 @@
+#ifndef BIN_MIX_PLANNER_H
+#define BIN_MIX_PLANNER_H
+
+/**
+ * @brief Plans how many bins of every requested bin are needed before any bin is packed.
+ *
+ * Every bin type gets an estimate of the number of bins it would need to take all items on its own.
+ * A bin then covers its share of the items, and the cheapest mix of bins which covers all items is
+ * found with a bounded knapsack over the coverage units, honouring the number of available bins.
+ *
+ */
+class BinMixPlanner
+{
+private:
+    std::vector<double> estimatedNrOfBins_;
+    std::vector<double> costs_;
+    std::vector<int> nrOfAvailableBins_;
+
+public:
+    BinMixPlanner(){};
+
+    /**
+     * @brief Get the number of items of an item type that fit in a bin when it only holds this item type, stacked in layers.
+     *
+     * The best allowed rotation is used, the count is limited by the weight and the item limit of the bin.
+     *
+     * @param aItemType
+     * @param aRequestedBin
+     * @return const int
+     */
+    static const int getHomogeneousCapacity(const std::shared_ptr<Item> &aItemType, const std::shared_ptr<RequestedBin> &aRequestedBin)
+    {
+        int64_t capacity = 0;
+
+        for (const char rotationType : aItemType->Item::allowedRotations_)
+        {
+            const std::array<int, 3> dimensions = FeasibilityIndex::getRotatedDimensions(aItemType, rotationType - '0');
+            if (dimensions[constants::axis::WIDTH] <= 0 || dimensions[constants::axis::DEPTH] <= 0 || dimensions[constants::axis::HEIGHT] <= 0)
+            {
+                continue;
+            };
+
+            capacity = std::max(capacity, (int64_t)(aRequestedBin->getWidth() / dimensions[constants::axis::WIDTH]) *
+                                              (aRequestedBin->getDepth() / dimensions[constants::axis::DEPTH]) *
+                                              (aRequestedBin->getHeight() / dimensions[constants::axis::HEIGHT]));
+        };
+
+        if (aItemType->Item::weight_ > 0)
+        {
+            capacity = std::min(capacity, (int64_t)(aRequestedBin->getMaxWeight() / aItemType->Item::weight_));
+        };
+
+        if (aRequestedBin->getItemLimit() > 0)
+        {
+            capacity = std::min(capacity, (int64_t)aRequestedBin->getItemLimit());
+        };
+
+        return (int)std::min(capacity, (int64_t)std::numeric_limits<int>::max());
+    }
+
+    /**
+     * @brief Add a bin type, bin types are planned in the order they are added.
+     *
+     * @param aEstimatedNrOfBins number of bins of this type needed to take all items, 0 if it can not take any item.
+     * @param aCost cost of a single bin.
+     * @param aNrOfAvailableBins 0 if not limited.
+     */
+    void addBinType(const double aEstimatedNrOfBins, const double aCost, const int aNrOfAvailableBins)
+    {
+        BinMixPlanner::estimatedNrOfBins_.push_back(aEstimatedNrOfBins);
+        BinMixPlanner::costs_.push_back(aCost);
+        BinMixPlanner::nrOfAvailableBins_.push_back(aNrOfAvailableBins);
+    }
+
+    /**
+     * @brief Get the cheapest number of bins per bin type which covers all items.
+     *
+     * A bin covers its units rounded down, so the plan rather holds a bin too many than too few.
+     * Returns an empty vector if the available bins can not cover all items.
+     *
+     * @return const std::vector<int>
+     */
+    const std::vector<int> plan() const
+    {
+        const int nrOfUnits = constants::binComposer::planner::NR_OF_COVERAGE_UNITS;
+        const int nrOfBinTypes = (int)BinMixPlanner::costs_.size();
+        const double noCost = std::numeric_limits<double>::max();
+
+        // Cheapest cost found to cover at least the given number of units.
+        std::vector<double> costs(nrOfUnits + 1, noCost);
+        costs[0] = 0;
+        std::vector<std::vector<int>> nrOfBinsChosen(nrOfBinTypes, std::vector<int>(nrOfUnits + 1, 0));
+        std::vector<int> unitsPerBin(nrOfBinTypes, 0);
+
+        for (int binType = 0; binType < nrOfBinTypes; binType++)
+        {
+            if (BinMixPlanner::estimatedNrOfBins_[binType] <= 0)
+            {
+                continue;
+            };
+
+            unitsPerBin[binType] = std::max(1, (int)(nrOfUnits / BinMixPlanner::estimatedNrOfBins_[binType]));
+            int maxNrOfBins = (nrOfUnits + unitsPerBin[binType] - 1) / unitsPerBin[binType];
+            if (BinMixPlanner::nrOfAvailableBins_[binType] > 0)
+            {
+                maxNrOfBins = std::min(maxNrOfBins, BinMixPlanner::nrOfAvailableBins_[binType]);
+            };
+
+            std::vector<double> newCosts = costs;
+            for (int units = 1; units <= nrOfUnits; units++)
+            {
+                for (int nrOfBins = 1; nrOfBins <= maxNrOfBins; nrOfBins++)
+                {
+                    const int unitsLeft = std::max(0, units - nrOfBins * unitsPerBin[binType]);
+                    if (costs[unitsLeft] == noCost)
+                    {
+                        continue;
+                    };
+
+                    const double cost = costs[unitsLeft] + nrOfBins * BinMixPlanner::costs_[binType];
+                    if (cost < newCosts[units])
+                    {
+                        newCosts[units] = cost;
+                        nrOfBinsChosen[binType][units] = nrOfBins;
+                    };
+
+                    if (unitsLeft == 0)
+                    {
+                        break;
+                    };
+                };
+            };
+            costs = std::move(newCosts);
+        };
+
+        if (costs[nrOfUnits] == noCost)
+        {
+            return {};
+        };
+
+        std::vector<int> plannedBins(nrOfBinTypes, 0);
+        int units = nrOfUnits;
+        for (int binType = nrOfBinTypes; binType--;)
+        {
+            plannedBins[binType] = nrOfBinsChosen[binType][units];
+            units = std::max(0, units - plannedBins[binType] * unitsPerBin[binType]);
+        };
+
+        return plannedBins;
+    }
+};
+
+#endif
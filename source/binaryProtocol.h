@@ -0,0 +1,688 @@
+#ifndef BINARY_PROTOCOL_H
+#define BINARY_PROTOCOL_H
+
+/*
+    BINARY PROTOCOL.
+
+    Compact little-endian request/response format for callers that generate requests by machine.
+    The layout is documented in binaryProtocol.md, the structs below are the wire records.
+
+    All records are fixed width and 8 byte aligned, a request can be read in place, for example from a mmapped file.
+    Dimensions and positions are integers expressed in 1/MULTIPLIER units, weights are doubles.
+*/
+
+static_assert(__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__, "The binary protocol is only supported on little-endian hosts.");
+
+struct BinaryRequestHeader
+{
+    char magic_[4];
+    uint16_t version_;
+    uint16_t headerSize_;
+    uint16_t binRecordSize_;
+    uint16_t itemRecordSize_;
+    uint32_t nrOfBins_;
+    uint32_t nrOfItems_;
+    uint32_t nrOfCompatibleBinRefs_;
+    uint32_t stringTableSize_;
+    int32_t minimizationStrategy_;
+    uint32_t maxNrOfThreads_;
+    uint32_t maxNrOfItemsPerShard_;
+};
+
+struct BinaryBinRecord
+{
+    int32_t width_;
+    int32_t depth_;
+    int32_t height_;
+    int32_t nrOfAvailableBins_;
+    int32_t itemLimit_;
+    uint32_t type_;
+    double maxWeight_;
+    double gravityStrength_;
+    uint8_t packingDirection_;
+    uint8_t sortMethod_;
+    uint8_t openBinPolicy_;
+    uint8_t nrOfOpenBins_;
+    uint8_t nrOfZones_;
+    uint8_t nrOfSpeculativeBins_;
+    uint8_t reserved_[2];
+};
+
+struct BinaryItemRecord
+{
+    int32_t width_;
+    int32_t depth_;
+    int32_t height_;
+    uint32_t id_;
+    double weight_;
+    double gravityStrength_;
+    uint32_t itemConsolidationKey_;
+    uint32_t allowedRotations_;
+    uint32_t compatibleBinsStart_;
+    uint16_t nrOfCompatibleBins_;
+    uint8_t stackingStyle_;
+    uint8_t reserved_;
+    uint32_t quantity_;
+    uint32_t reserved2_;
+};
+
+struct BinaryResponseHeader
+{
+    char magic_[4];
+    uint16_t version_;
+    uint16_t headerSize_;
+    uint16_t binSummarySize_;
+    uint16_t placementSize_;
+    uint32_t nrOfBins_;
+    uint32_t nrOfPlacements_;
+    uint32_t nrOfUnfittedItems_;
+    double totalVolumeUtil_;
+    double totalWeightUtil_;
+};
+
+struct BinaryBinSummary
+{
+    uint32_t id_;
+    uint32_t requestedBinIndex_;
+    uint32_t firstPlacement_;
+    uint32_t nrOfItems_;
+    double actualVolume_;
+    double actualWeight_;
+    int32_t furthestPointWidth_;
+    int32_t furthestPointDepth_;
+    int32_t furthestPointHeight_;
+    uint32_t reserved_;
+};
+
+struct BinaryPlacement
+{
+    uint32_t itemIndex_;
+    uint32_t binId_;
+    int32_t x_;
+    int32_t y_;
+    int32_t z_;
+    uint8_t rotationType_;
+    uint8_t reserved_[3];
+};
+
+static_assert(sizeof(BinaryRequestHeader) == 40, "Unexpected BinaryRequestHeader size.");
+static_assert(sizeof(BinaryBinRecord) == 48, "Unexpected BinaryBinRecord size.");
+static_assert(sizeof(BinaryItemRecord) == 56, "Unexpected BinaryItemRecord size.");
+static_assert(sizeof(BinaryResponseHeader) == 40, "Unexpected BinaryResponseHeader size.");
+static_assert(sizeof(BinaryBinSummary) == 48, "Unexpected BinaryBinSummary size.");
+static_assert(sizeof(BinaryPlacement) == 24, "Unexpected BinaryPlacement size.");
+
+/**
+ * @brief Reads a binary request in place.
+ *
+ * The reader validates the header and section sizes once, afterwards records are accessed directly in the buffer.
+ * Records which are bigger than the known record size (written by a newer version) are accepted, the extra bytes are ignored.
+ *
+ */
+class BinaryRequestReader
+{
+private:
+    const char *buffer_;
+    std::size_t bufferSize_;
+    bool valid_;
+    BinaryRequestHeader header_;
+    const char *bins_;
+    const char *items_;
+    const uint32_t *compatibleBinRefs_;
+    const char *stringTable_;
+    const char *const *strings_;
+    uint32_t nrOfStrings_;
+    std::vector<int> firstItemKeys_;
+
+    /**
+     * @brief Validate the header and locate the sections of the request.
+     *
+     */
+    void validate()
+    {
+        if (BinaryRequestReader::bufferSize_ < sizeof(BinaryRequestHeader) ||
+            reinterpret_cast<std::uintptr_t>(BinaryRequestReader::buffer_) % alignof(double) != 0)
+        {
+            return;
+        }
+
+        std::memcpy(&(BinaryRequestReader::header_), BinaryRequestReader::buffer_, sizeof(BinaryRequestHeader));
+
+        if (std::memcmp(BinaryRequestReader::header_.magic_, constants::binary::REQUEST_MAGIC, sizeof(constants::binary::REQUEST_MAGIC)) != 0 ||
+            BinaryRequestReader::header_.version_ > constants::binary::VERSION ||
+            BinaryRequestReader::header_.headerSize_ < sizeof(BinaryRequestHeader) ||
+            BinaryRequestReader::header_.binRecordSize_ < sizeof(BinaryBinRecord) ||
+            BinaryRequestReader::header_.itemRecordSize_ < sizeof(BinaryItemRecord) ||
+            BinaryRequestReader::header_.headerSize_ % alignof(double) != 0 ||
+            BinaryRequestReader::header_.binRecordSize_ % alignof(double) != 0 ||
+            BinaryRequestReader::header_.itemRecordSize_ % alignof(double) != 0)
+        {
+            return;
+        }
+
+        // Compute the section offsets in 64 bits so that no count can overflow them.
+        const uint64_t binsOffset = BinaryRequestReader::header_.headerSize_;
+        const uint64_t itemsOffset = binsOffset + (uint64_t)BinaryRequestReader::header_.nrOfBins_ * BinaryRequestReader::header_.binRecordSize_;
+        const uint64_t refsOffset = itemsOffset + (uint64_t)BinaryRequestReader::header_.nrOfItems_ * BinaryRequestReader::header_.itemRecordSize_;
+        const uint64_t stringsOffset = refsOffset + (uint64_t)BinaryRequestReader::header_.nrOfCompatibleBinRefs_ * sizeof(uint32_t);
+        const uint64_t totalSize = stringsOffset + BinaryRequestReader::header_.stringTableSize_;
+
+        // The string table always starts with the empty string and must be terminated.
+        if (totalSize > BinaryRequestReader::bufferSize_ ||
+            BinaryRequestReader::header_.stringTableSize_ == 0 ||
+            BinaryRequestReader::buffer_[stringsOffset] != '\0' ||
+            BinaryRequestReader::buffer_[totalSize - 1] != '\0')
+        {
+            return;
+        }
+
+        BinaryRequestReader::bins_ = BinaryRequestReader::buffer_ + binsOffset;
+        BinaryRequestReader::items_ = BinaryRequestReader::buffer_ + itemsOffset;
+        BinaryRequestReader::compatibleBinRefs_ = reinterpret_cast<const uint32_t *>(BinaryRequestReader::buffer_ + refsOffset);
+        BinaryRequestReader::stringTable_ = BinaryRequestReader::buffer_ + stringsOffset;
+        BinaryRequestReader::nrOfStrings_ = BinaryRequestReader::header_.stringTableSize_;
+
+        BinaryRequestReader::validateReferences();
+    }
+
+    /**
+     * @brief Validate all string and compatible bin references once, so that accessing records afterwards does not need any checks.
+     *
+     */
+    void validateReferences()
+    {
+        for (uint32_t idx = 0; idx < BinaryRequestReader::header_.nrOfBins_; idx++)
+        {
+            if (!BinaryRequestReader::validString(BinaryRequestReader::getBin(idx).type_))
+            {
+                return;
+            }
+        }
+
+        for (uint32_t idx = 0; idx < BinaryRequestReader::header_.nrOfItems_; idx++)
+        {
+            const BinaryItemRecord &item = BinaryRequestReader::getItem(idx);
+            if (!BinaryRequestReader::validString(item.id_) ||
+                !BinaryRequestReader::validString(item.itemConsolidationKey_) ||
+                !BinaryRequestReader::validString(item.allowedRotations_) ||
+                (uint64_t)item.compatibleBinsStart_ + item.nrOfCompatibleBins_ > BinaryRequestReader::header_.nrOfCompatibleBinRefs_)
+            {
+                return;
+            }
+        }
+
+        for (uint32_t idx = 0; idx < BinaryRequestReader::header_.nrOfCompatibleBinRefs_; idx++)
+        {
+            if (!BinaryRequestReader::validString(BinaryRequestReader::compatibleBinRefs_[idx]))
+            {
+                return;
+            }
+        }
+
+        // Items of a record get consecutive keys, the total must fit the int item keys.
+        int64_t itemKey = 1;
+        BinaryRequestReader::firstItemKeys_.reserve(BinaryRequestReader::header_.nrOfItems_ + 1);
+        for (uint32_t idx = 0; idx < BinaryRequestReader::header_.nrOfItems_; idx++)
+        {
+            BinaryRequestReader::firstItemKeys_.push_back((int)itemKey);
+            itemKey += BinaryRequestReader::getQuantity(BinaryRequestReader::getItem(idx));
+            if (itemKey > std::numeric_limits<int>::max())
+            {
+                return;
+            }
+        }
+        BinaryRequestReader::firstItemKeys_.push_back((int)itemKey);
+
+        BinaryRequestReader::valid_ = true;
+    }
+
+    inline const bool validString(const uint32_t aString) const
+    {
+        return aString < BinaryRequestReader::nrOfStrings_ &&
+               (!BinaryRequestReader::strings_ || BinaryRequestReader::strings_[aString]);
+    };
+
+    /**
+     * @brief Translate the sort method enumeration to the sort method text used by the item register.
+     *
+     * @param aSortMethod
+     * @return const std::string
+     */
+    const std::string sortMethodText(const uint8_t aSortMethod) const
+    {
+        switch (aSortMethod)
+        {
+        case constants::binary::sortMethod::VOLUME:
+            return constants::itemRegister::parameter::sortMethod::VOLUME;
+        case constants::binary::sortMethod::WEIGHT:
+            return constants::itemRegister::parameter::sortMethod::WEIGHT;
+        default:
+            return constants::itemRegister::parameter::sortMethod::OPTIMIZED;
+        }
+    }
+
+    /**
+     * @brief Translate the open bin policy enumeration of the request to the open bin policy text of the requested bin.
+     *
+     * @param aOpenBinPolicy
+     * @return const std::string
+     */
+    const std::string openBinPolicyText(const uint8_t aOpenBinPolicy) const
+    {
+        switch (aOpenBinPolicy)
+        {
+        case constants::binary::openBinPolicy::FIRST_FIT:
+            return constants::bin::parameter::FIRST_FIT_TEXT;
+        case constants::binary::openBinPolicy::BEST_FIT:
+            return constants::bin::parameter::BEST_FIT_TEXT;
+        default:
+            return constants::bin::parameter::NEXT_FIT_TEXT;
+        }
+    }
+
+    /**
+     * @brief Translate the stacking style enumeration of the request to the stacking style of the item.
+     *
+     * @param aStackingStyle
+     * @return const int
+     */
+    const int getStackingStyle(const uint8_t aStackingStyle) const
+    {
+        switch (aStackingStyle)
+        {
+        case constants::binary::stackingStyle::NO_ITEMS_ON_TOP:
+            return constants::item::stackingStyle::NO_ITEMS_ON_TOP;
+        case constants::binary::stackingStyle::BOTTOM_NO_ITEMS_ON_TOP:
+            return constants::item::stackingStyle::BOTTOM_NO_ITEMS_ON_TOP;
+        default:
+            return constants::item::stackingStyle::ALLOW_ALL;
+        }
+    }
+
+public:
+    BinaryRequestReader(const char *aBuffer, const std::size_t aBufferSize) : buffer_(aBuffer),
+                                                                             bufferSize_(aBufferSize),
+                                                                             valid_(false),
+                                                                             header_(),
+                                                                             bins_(nullptr),
+                                                                             items_(nullptr),
+                                                                             compatibleBinRefs_(nullptr),
+                                                                             stringTable_(nullptr),
+                                                                             strings_(nullptr),
+                                                                             nrOfStrings_(0)
+    {
+        BinaryRequestReader::validate();
+    };
+
+    /**
+     * @brief Read a request which is passed as record arrays, string fields are indices in aStrings.
+     *
+     * @param aBins
+     * @param aNrOfBins
+     * @param aItems
+     * @param aNrOfItems
+     * @param aCompatibleBinRefs
+     * @param aNrOfCompatibleBinRefs
+     * @param aStrings
+     * @param aNrOfStrings
+     * @param aMinimizationStrategy
+     */
+    BinaryRequestReader(const BinaryBinRecord *aBins,
+                        const uint32_t aNrOfBins,
+                        const BinaryItemRecord *aItems,
+                        const uint32_t aNrOfItems,
+                        const uint32_t *aCompatibleBinRefs,
+                        const uint32_t aNrOfCompatibleBinRefs,
+                        const char *const *aStrings,
+                        const uint32_t aNrOfStrings,
+                        const int aMinimizationStrategy) : buffer_(nullptr),
+                                                           bufferSize_(0),
+                                                           valid_(false),
+                                                           header_(),
+                                                           bins_(reinterpret_cast<const char *>(aBins)),
+                                                           items_(reinterpret_cast<const char *>(aItems)),
+                                                           compatibleBinRefs_(aCompatibleBinRefs),
+                                                           stringTable_(nullptr),
+                                                           strings_(aStrings),
+                                                           nrOfStrings_(aStrings ? aNrOfStrings : 0)
+    {
+        std::memcpy(BinaryRequestReader::header_.magic_, constants::binary::REQUEST_MAGIC, sizeof(constants::binary::REQUEST_MAGIC));
+        BinaryRequestReader::header_.version_ = constants::binary::VERSION;
+        BinaryRequestReader::header_.headerSize_ = sizeof(BinaryRequestHeader);
+        BinaryRequestReader::header_.binRecordSize_ = sizeof(BinaryBinRecord);
+        BinaryRequestReader::header_.itemRecordSize_ = sizeof(BinaryItemRecord);
+        BinaryRequestReader::header_.nrOfBins_ = aBins ? aNrOfBins : 0;
+        BinaryRequestReader::header_.nrOfItems_ = aItems ? aNrOfItems : 0;
+        BinaryRequestReader::header_.nrOfCompatibleBinRefs_ = aCompatibleBinRefs ? aNrOfCompatibleBinRefs : 0;
+        BinaryRequestReader::header_.minimizationStrategy_ = aMinimizationStrategy;
+
+        BinaryRequestReader::validateReferences();
+    };
+
+    /**
+     * @brief Checks if a buffer starts with the binary request magic.
+     *
+     * @param aBuffer
+     * @param aBufferSize
+     * @return true
+     * @return false
+     */
+    static const bool isBinaryRequest(const char *aBuffer, const std::size_t aBufferSize)
+    {
+        return aBufferSize >= sizeof(constants::binary::REQUEST_MAGIC) &&
+               std::memcmp(aBuffer, constants::binary::REQUEST_MAGIC, sizeof(constants::binary::REQUEST_MAGIC)) == 0;
+    }
+
+    const bool isValid() const { return BinaryRequestReader::valid_; };
+    const int getNumberOfBins() const { return BinaryRequestReader::header_.nrOfBins_; };
+    const int getNumberOfItems() const { return BinaryRequestReader::valid_ ? BinaryRequestReader::firstItemKeys_.back() - 1 : 0; };
+
+    /**
+     * @brief Get the number of items of an item record, a quantity of 0 counts as 1.
+     *
+     * @param aItem
+     * @return const uint32_t
+     */
+    static const uint32_t getQuantity(const BinaryItemRecord &aItem) { return std::max(aItem.quantity_, (uint32_t)1); };
+
+    /**
+     * @brief Get the index of the item record an item key belongs to.
+     *
+     * @param aItemKey
+     * @return const uint32_t
+     */
+    const uint32_t getItemIndex(const int aItemKey) const
+    {
+        return (uint32_t)(std::upper_bound(BinaryRequestReader::firstItemKeys_.begin(), BinaryRequestReader::firstItemKeys_.end(), aItemKey) -
+                          BinaryRequestReader::firstItemKeys_.begin() - 1);
+    };
+
+    /**
+     * @brief Get the minimization strategy of the request, 0 means the default strategy.
+     *
+     * @return const int
+     */
+    const int getMinimizationStrategy() const
+    {
+        return BinaryRequestReader::header_.minimizationStrategy_ ? BinaryRequestReader::header_.minimizationStrategy_ : DEFAULT_MINIMIZATION_STRATEGY;
+    };
+
+    /**
+     * @brief Get the number of threads the request may use, 0 means the default number of threads.
+     *
+     * @return const int
+     */
+    const int getMaxNrOfThreads() const
+    {
+        return BinaryRequestReader::header_.maxNrOfThreads_ ? (int)std::min(BinaryRequestReader::header_.maxNrOfThreads_, (uint32_t)constants::taskScheduler::MAX_NR_OF_PARTICIPANTS) : DEFAULT_MAX_THREADS_PER_REQUEST;
+    };
+
+    /**
+     * @brief Get the maximum number of items of a shard, 0 means the default shard size.
+     *
+     * @return const int
+     */
+    const int getMaxNrOfItemsPerShard() const
+    {
+        return BinaryRequestReader::header_.maxNrOfItemsPerShard_ ? (int)std::min(BinaryRequestReader::header_.maxNrOfItemsPerShard_, (uint32_t)std::numeric_limits<int>::max()) : DEFAULT_MAX_NR_OF_ITEMS_PER_SHARD;
+    };
+
+    const BinaryBinRecord &getBin(const uint32_t aIndex) const
+    {
+        return *reinterpret_cast<const BinaryBinRecord *>(BinaryRequestReader::bins_ + (std::size_t)aIndex * BinaryRequestReader::header_.binRecordSize_);
+    };
+
+    const BinaryItemRecord &getItem(const uint32_t aIndex) const
+    {
+        return *reinterpret_cast<const BinaryItemRecord *>(BinaryRequestReader::items_ + (std::size_t)aIndex * BinaryRequestReader::header_.itemRecordSize_);
+    };
+
+    /**
+     * @brief Get a string, by offset in the string table or by index in the string array.
+     *
+     * @param aString
+     * @return const char*
+     */
+    const char *getString(const uint32_t aString) const
+    {
+        return BinaryRequestReader::strings_ ? BinaryRequestReader::strings_[aString] : BinaryRequestReader::stringTable_ + aString;
+    };
+
+    /**
+     * @brief Get the index of the first requested bin with the provided type.
+     *
+     * @param aType
+     * @return const uint32_t
+     */
+    const uint32_t getBinIndex(const std::string &aType) const
+    {
+        for (uint32_t idx = 0; idx < BinaryRequestReader::header_.nrOfBins_; idx++)
+        {
+            if (aType == BinaryRequestReader::getString(BinaryRequestReader::getBin(idx).type_))
+            {
+                return idx;
+            }
+        }
+        return BinaryRequestReader::header_.nrOfBins_;
+    };
+
+    /**
+     * @brief Add the requested bins and items to the bin composer.
+     *
+     * Same order and transient ids as the json request, the items of a record get consecutive transient ids.
+     *
+     * @param aBinComposer
+     */
+    void populate(std::shared_ptr<BinComposer> &aBinComposer) const
+    {
+        for (int idx = BinaryRequestReader::getNumberOfBins(); idx--;)
+        {
+            const BinaryBinRecord &bin = BinaryRequestReader::getBin(idx);
+            std::shared_ptr<RequestedBin> requestedBin = std::make_shared<RequestedBin>(BinaryRequestReader::getString(bin.type_),
+                                                                                        bin.width_,
+                                                                                        bin.depth_,
+                                                                                        bin.height_,
+                                                                                        bin.maxWeight_,
+                                                                                        bin.nrOfAvailableBins_,
+                                                                                        bin.itemLimit_,
+                                                                                        bin.packingDirection_ == constants::binary::packingDirection::BACK_TO_FRONT
+                                                                                            ? constants::bin::parameter::BACK_TO_FRONT_TEXT
+                                                                                            : constants::bin::parameter::BOTTOM_UP_TEXT,
+                                                                                        BinaryRequestReader::sortMethodText(bin.sortMethod_),
+                                                                                        bin.gravityStrength_);
+            requestedBin->setOpenBinPolicy(BinaryRequestReader::openBinPolicyText(bin.openBinPolicy_), bin.nrOfOpenBins_);
+            requestedBin->setNrOfZones(bin.nrOfZones_);
+            requestedBin->setNrOfSpeculativeBins(bin.nrOfSpeculativeBins_);
+            aBinComposer->addRequestedBin(requestedBin);
+        };
+
+        for (int idx = BinaryRequestReader::header_.nrOfItems_; idx--;)
+        {
+            const BinaryItemRecord &item = BinaryRequestReader::getItem(idx);
+
+            std::vector<std::string> compatibleBins;
+            compatibleBins.reserve(item.nrOfCompatibleBins_);
+            for (int refIdx = item.nrOfCompatibleBins_; refIdx--;)
+            {
+                compatibleBins.push_back(BinaryRequestReader::getString(BinaryRequestReader::compatibleBinRefs_[item.compatibleBinsStart_ + refIdx]));
+            }
+
+            const int firstItemKey = BinaryRequestReader::firstItemKeys_[idx];
+            const std::shared_ptr<Item> itemType =
+                std::make_shared<Item>(firstItemKey,
+                                       BinaryRequestReader::getString(item.id_),
+                                       item.width_,
+                                       item.depth_,
+                                       item.height_,
+                                       item.weight_,
+                                       BinaryRequestReader::getString(item.itemConsolidationKey_),
+                                       BinaryRequestReader::getString(item.allowedRotations_),
+                                       item.gravityStrength_,
+                                       compatibleBins,
+                                       BinaryRequestReader::getStackingStyle(item.stackingStyle_));
+
+            // Item types are kept in the state of an unpacked item.
+            itemType->reset();
+
+            for (int itemKey = BinaryRequestReader::firstItemKeys_[idx + 1]; itemKey-- > firstItemKey;)
+            {
+                aBinComposer->getMasterItemRegister()->addItem(itemKey, itemType);
+                aBinComposer->addItem(itemKey);
+            };
+        };
+    }
+};
+
+/**
+ * @brief Writes the packing result of a bin composer as a binary response.
+ *
+ */
+class BinaryResponseWriter
+{
+private:
+    std::vector<BinaryBinSummary> binSummaries_;
+    std::vector<BinaryPlacement> placements_;
+    std::vector<uint32_t> unfittedItems_;
+    BinaryResponseHeader header_;
+
+public:
+    /**
+     * @brief Collect the packing result.
+     *
+     * @param aBinComposer
+     * @param aRequest      - used to translate bin types back to requested bin indices.
+     */
+    BinaryResponseWriter(std::shared_ptr<BinComposer> &aBinComposer, const BinaryRequestReader &aRequest) : header_()
+    {
+        for (const std::shared_ptr<Bin> &bin : aBinComposer->getPackedBins())
+        {
+            BinaryBinSummary summary = {};
+            summary.id_ = bin->id_;
+            summary.requestedBinIndex_ = aRequest.getBinIndex(bin->type_);
+            summary.firstPlacement_ = BinaryResponseWriter::placements_.size();
+            summary.nrOfItems_ = bin->getFittedItems().size();
+            summary.actualVolume_ = bin->getRealActualVolumeUtil();
+            summary.actualWeight_ = bin->getRealActualWeightUtil();
+            summary.furthestPointWidth_ = bin->furthestPointWidth_;
+            summary.furthestPointDepth_ = bin->furthestPointDepth_;
+            summary.furthestPointHeight_ = bin->furthestPointHeight_;
+            BinaryResponseWriter::binSummaries_.push_back(summary);
+
+            for (int idx = 0; idx < (int)bin->getFittedItems().size(); idx++)
+            {
+                const std::shared_ptr<Item> &item = bin->getPackedItems()[idx];
+
+                BinaryPlacement placement = {};
+                placement.itemIndex_ = aRequest.getItemIndex(bin->getFittedItems()[idx]);
+                placement.binId_ = bin->id_;
+                placement.x_ = item->position_[constants::axis::WIDTH];
+                placement.y_ = item->position_[constants::axis::DEPTH];
+                placement.z_ = item->position_[constants::axis::HEIGHT];
+                placement.rotationType_ = item->rotationType_;
+                BinaryResponseWriter::placements_.push_back(placement);
+            }
+        }
+
+        for (const int itemKey : aBinComposer->getItemsToBePacked())
+        {
+            BinaryResponseWriter::unfittedItems_.push_back(aRequest.getItemIndex(itemKey));
+        }
+
+        std::memcpy(BinaryResponseWriter::header_.magic_, constants::binary::RESPONSE_MAGIC, sizeof(constants::binary::RESPONSE_MAGIC));
+        BinaryResponseWriter::header_.version_ = constants::binary::VERSION;
+        BinaryResponseWriter::header_.headerSize_ = sizeof(BinaryResponseHeader);
+        BinaryResponseWriter::header_.binSummarySize_ = sizeof(BinaryBinSummary);
+        BinaryResponseWriter::header_.placementSize_ = sizeof(BinaryPlacement);
+        BinaryResponseWriter::header_.nrOfBins_ = BinaryResponseWriter::binSummaries_.size();
+        BinaryResponseWriter::header_.nrOfPlacements_ = BinaryResponseWriter::placements_.size();
+        BinaryResponseWriter::header_.nrOfUnfittedItems_ = BinaryResponseWriter::unfittedItems_.size();
+
+        if (aBinComposer->getNumberOfBins())
+        {
+            BinaryResponseWriter::header_.totalVolumeUtil_ = aBinComposer->getTotalVolumeUtilPercentage();
+            BinaryResponseWriter::header_.totalWeightUtil_ = aBinComposer->getTotalWeightUtilPercentage();
+        }
+    };
+
+    /**
+     * @brief Get the number of bytes required to write the response.
+     *
+     * @return const std::size_t
+     */
+    const std::size_t getSize() const
+    {
+        return sizeof(BinaryResponseHeader) +
+               BinaryResponseWriter::binSummaries_.size() * sizeof(BinaryBinSummary) +
+               BinaryResponseWriter::placements_.size() * sizeof(BinaryPlacement) +
+               BinaryResponseWriter::unfittedItems_.size() * sizeof(uint32_t);
+    };
+
+    /**
+     * @brief Copy the response to caller provided arrays.
+     *
+     * The header is always filled, so a caller can retry with arrays of the reported sizes.
+     *
+     * @param aHeader
+     * @param aBinSummaries
+     * @param aBinSummaryCapacity
+     * @param aPlacements
+     * @param aPlacementCapacity
+     * @param aUnfittedItems
+     * @param aUnfittedItemCapacity
+     * @return const int               - 0, or constants::binary::status::BUFFER_TOO_SMALL.
+     */
+    const int write(BinaryResponseHeader *aHeader,
+                    BinaryBinSummary *aBinSummaries,
+                    const std::size_t aBinSummaryCapacity,
+                    BinaryPlacement *aPlacements,
+                    const std::size_t aPlacementCapacity,
+                    uint32_t *aUnfittedItems,
+                    const std::size_t aUnfittedItemCapacity) const
+    {
+        *aHeader = BinaryResponseWriter::header_;
+
+        if (BinaryResponseWriter::binSummaries_.size() > aBinSummaryCapacity ||
+            BinaryResponseWriter::placements_.size() > aPlacementCapacity ||
+            BinaryResponseWriter::unfittedItems_.size() > aUnfittedItemCapacity)
+        {
+            return constants::binary::status::BUFFER_TOO_SMALL;
+        }
+
+        std::copy(BinaryResponseWriter::binSummaries_.begin(), BinaryResponseWriter::binSummaries_.end(), aBinSummaries);
+        std::copy(BinaryResponseWriter::placements_.begin(), BinaryResponseWriter::placements_.end(), aPlacements);
+        std::copy(BinaryResponseWriter::unfittedItems_.begin(), BinaryResponseWriter::unfittedItems_.end(), aUnfittedItems);
+        return 0;
+    };
+
+    /**
+     * @brief Write the response to the buffer.
+     *
+     * @param aBuffer
+     * @param aBufferSize
+     * @return const int     - number of bytes written, or constants::binary::status::BUFFER_TOO_SMALL.
+     */
+    const int write(char *aBuffer, const std::size_t aBufferSize) const
+    {
+        if (BinaryResponseWriter::getSize() > aBufferSize)
+        {
+            return constants::binary::status::BUFFER_TOO_SMALL;
+        }
+
+        char *it = aBuffer;
+        std::memcpy(it, &(BinaryResponseWriter::header_), sizeof(BinaryResponseHeader));
+        it += sizeof(BinaryResponseHeader);
+
+        std::memcpy(it, BinaryResponseWriter::binSummaries_.data(), BinaryResponseWriter::binSummaries_.size() * sizeof(BinaryBinSummary));
+        it += BinaryResponseWriter::binSummaries_.size() * sizeof(BinaryBinSummary);
+
+        std::memcpy(it, BinaryResponseWriter::placements_.data(), BinaryResponseWriter::placements_.size() * sizeof(BinaryPlacement));
+        it += BinaryResponseWriter::placements_.size() * sizeof(BinaryPlacement);
+
+        std::memcpy(it, BinaryResponseWriter::unfittedItems_.data(), BinaryResponseWriter::unfittedItems_.size() * sizeof(uint32_t));
+        it += BinaryResponseWriter::unfittedItems_.size() * sizeof(uint32_t);
+
+        return (int)(it - aBuffer);
+    };
+};
+
+#endif
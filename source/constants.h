@@ -56,7 +56,20 @@ namespace constants
             constexpr const unsigned int VOLUME{10};
             constexpr const unsigned int BINS{20};
             constexpr const unsigned int STRICT_BINS{30};
+            constexpr const unsigned int PLANNED{40};
         }
+
+        namespace planner
+        {
+            // Resolution of the bin mix plan, a bin covers a share of the items in these units.
+            constexpr const int NR_OF_COVERAGE_UNITS{1000};
+        }
+    }
+
+    namespace taskScheduler
+    {
+        // Threads that can take part in a single parallel loop, the thread that started it included.
+        constexpr const int MAX_NR_OF_PARTICIPANTS{64};
     }
 
     namespace item
@@ -67,6 +80,13 @@ namespace constants
             const std::string NO_ITEMS_ON_TOP = "NOITEMSONTOP";
             const std::string BOTTOM_NO_ITEMS_ON_TOP = "BOTTOMNOITEMSONTOP";
         };
+
+        namespace stackingStyle
+        {
+            constexpr const int ALLOW_ALL{0};
+            constexpr const int NO_ITEMS_ON_TOP{1};
+            constexpr const int BOTTOM_NO_ITEMS_ON_TOP{2};
+        };
     }
 
     constexpr const unsigned int R{constants::axis::ALL.size()};
@@ -76,7 +96,7 @@ namespace constants
 
         namespace itemConsolidationKey
         {
-            const std::string PO_INTERNAL_ALL = "PO_INTERNAL_ALL";
+            constexpr const int PO_INTERNAL_ALL{-1};
         };
 
         namespace parameter
@@ -96,9 +116,76 @@ namespace constants
         {
             const std::string BOTTOM_UP_TEXT = "BOTTOMUP";
             const std::string BACK_TO_FRONT_TEXT = "BACKTOFRONT";
-            const std::array<int, 3> BOTTOM_UP_ARRAY = {constants::axis::WIDTH, constants::axis::DEPTH, constants::axis::HEIGHT};
-            const std::array<int, 3> BACK_TO_FRONT_ARRAY = {constants::axis::WIDTH, constants::axis::HEIGHT, constants::axis::DEPTH};
+            constexpr std::array<int, 3> BOTTOM_UP_ARRAY = {constants::axis::WIDTH, constants::axis::DEPTH, constants::axis::HEIGHT};
+            constexpr std::array<int, 3> BACK_TO_FRONT_ARRAY = {constants::axis::WIDTH, constants::axis::HEIGHT, constants::axis::DEPTH};
+
+            const std::string NEXT_FIT_TEXT = "NEXTFIT";
+            const std::string FIRST_FIT_TEXT = "FIRSTFIT";
+            const std::string BEST_FIT_TEXT = "BESTFIT";
+
+            namespace openBinPolicy
+            {
+                constexpr const int NEXT_FIT{0};
+                constexpr const int FIRST_FIT{1};
+                constexpr const int BEST_FIT{2};
+            }
+
+            // Number of bins kept open by the first and best fit policies if the request does not set it.
+            constexpr const int DEFAULT_NR_OF_OPEN_BINS{4};
+
+        }
+
+        namespace zone
+        {
+            // A bin is only split into zones if every zone gets at least this many items.
+            constexpr const int MIN_NR_OF_ITEMS{100};
+        }
+
+        namespace rejection
+        {
+            constexpr const int NOT_REJECTED{-1};
+            constexpr const int ALWAYS_REJECTED{-2};
+        }
+    }
 
+    namespace binary
+    {
+        constexpr const char REQUEST_MAGIC[4] = {'P', 'T', 'M', 'B'};
+        constexpr const char RESPONSE_MAGIC[4] = {'P', 'T', 'M', 'R'};
+        constexpr const unsigned int VERSION{1};
+        constexpr const unsigned int NO_STRING{0};
+
+        namespace status
+        {
+            constexpr const int INVALID_REQUEST{-1};
+            constexpr const int BUFFER_TOO_SMALL{-2};
+        }
+
+        namespace packingDirection
+        {
+            constexpr const unsigned int BOTTOM_UP{0};
+            constexpr const unsigned int BACK_TO_FRONT{1};
+        }
+
+        namespace openBinPolicy
+        {
+            constexpr const unsigned int NEXT_FIT{0};
+            constexpr const unsigned int FIRST_FIT{1};
+            constexpr const unsigned int BEST_FIT{2};
+        }
+
+        namespace sortMethod
+        {
+            constexpr const unsigned int OPTIMIZED{0};
+            constexpr const unsigned int VOLUME{1};
+            constexpr const unsigned int WEIGHT{2};
+        }
+
+        namespace stackingStyle
+        {
+            constexpr const unsigned int ALLOW_ALL{0};
+            constexpr const unsigned int NO_ITEMS_ON_TOP{1};
+            constexpr const unsigned int BOTTOM_NO_ITEMS_ON_TOP{2};
         }
     }
 
@@ -108,22 +195,32 @@ namespace constants
         {
             namespace bins
             {
-                const std::string BINS = "bins";
-                const std::string TYPE = "type";
-                const std::string WIDTH = "width";
-                const std::string DEPTH = "depth";
-                const std::string HEIGHT = "height";
-                const std::string MAX_WEIGHT = "maxWeight";
-                const std::string SORT_METHOD = "sortMethod";
-                const std::string GRAVITY_STRENGTH = "gravityStrength";
-                const std::string PACKING_DIRECTION = "packingDirection";
-                const std::string NR_OF_AVAILABLE_BINS = "nrOfAvailableBins";
-                const std::string ITEM_LIMIT = "itemLimit";
+                constexpr const char BINS[] = "bins";
+                constexpr const char TYPE[] = "type";
+                constexpr const char WIDTH[] = "width";
+                constexpr const char DEPTH[] = "depth";
+                constexpr const char HEIGHT[] = "height";
+                constexpr const char MAX_WEIGHT[] = "maxWeight";
+                constexpr const char SORT_METHOD[] = "sortMethod";
+                constexpr const char GRAVITY_STRENGTH[] = "gravityStrength";
+                constexpr const char PACKING_DIRECTION[] = "packingDirection";
+                constexpr const char NR_OF_AVAILABLE_BINS[] = "nrOfAvailableBins";
+                constexpr const char ITEM_LIMIT[] = "itemLimit";
+                constexpr const char OPEN_BIN_POLICY[] = "openBinPolicy";
+                constexpr const char NR_OF_OPEN_BINS[] = "nrOfOpenBins";
+                constexpr const char NR_OF_ZONES[] = "nrOfZones";
+                constexpr const char NR_OF_SPECULATIVE_BINS[] = "nrOfSpeculativeBins";
             };
 
             namespace item
             {
-                const std::string ITEMS = "items";
+                constexpr const char ITEMS[] = "items";
+            }
+
+            namespace request
+            {
+                constexpr const char MAX_NR_OF_THREADS[] = "maxNrOfThreads";
+                constexpr const char MAX_NR_OF_ITEMS_PER_SHARD[] = "maxNrOfItemsPerShard";
             }
         };
 
@@ -161,24 +258,25 @@ namespace constants
 
         namespace item
         {
-            const std::string ID = "id";
-            const std::string SHAPE = "shape";
-            const std::string WIDTH = "width";
-            const std::string DEPTH = "depth";
-            const std::string HEIGHT = "height";
-            const std::string DIAMETER = "diameter";
-            const std::string WEIGHT = "weight";
-            const std::string VOLUME = "volume";
-            const std::string ITEM_CONS_KEY = "itemConsKey";
-            const std::string ALLOWED_ROTATIONS = "allowedRotations";
-            const std::string X_COORDINATE = "xCoordinate";
-            const std::string Y_COORDINATE = "yCoordinate";
-            const std::string Z_COORDINATE = "zCoordinate";
-            const std::string ROTATION_TYPE = "rotationType";
-            const std::string ROTATION_TYPE_DESCRIPTION = "rotationTypeDescription";
-            const std::string GRAVITY_STRENGTH = "gravityStrength";
-            const std::string STACKING_STYLE = "stackingStyle";
-            const std::string COMPATIBLE_BINS = "compatibleBins";
+            constexpr const char ID[] = "id";
+            constexpr const char SHAPE[] = "shape";
+            constexpr const char WIDTH[] = "width";
+            constexpr const char DEPTH[] = "depth";
+            constexpr const char HEIGHT[] = "height";
+            constexpr const char DIAMETER[] = "diameter";
+            constexpr const char WEIGHT[] = "weight";
+            constexpr const char VOLUME[] = "volume";
+            constexpr const char ITEM_CONS_KEY[] = "itemConsKey";
+            constexpr const char ALLOWED_ROTATIONS[] = "allowedRotations";
+            constexpr const char X_COORDINATE[] = "xCoordinate";
+            constexpr const char Y_COORDINATE[] = "yCoordinate";
+            constexpr const char Z_COORDINATE[] = "zCoordinate";
+            constexpr const char ROTATION_TYPE[] = "rotationType";
+            constexpr const char ROTATION_TYPE_DESCRIPTION[] = "rotationTypeDescription";
+            constexpr const char GRAVITY_STRENGTH[] = "gravityStrength";
+            constexpr const char STACKING_STYLE[] = "stackingStyle";
+            constexpr const char COMPATIBLE_BINS[] = "compatibleBins";
+            constexpr const char QUANTITY[] = "quantity";
 
             namespace stackingStyle
             {
@@ -0,0 +1,155 @@
+#ifndef FEASIBILITY_INDEX_H
+#define FEASIBILITY_INDEX_H
+
+/**
+ * @brief Index of the bin types in which an item type fits in at least one of its allowed rotations.
+ *
+ * Built once before packing without rotating any item, afterwards it is only read so it can be shared by packers running at the same time.
+ *
+ */
+class FeasibilityIndex
+{
+private:
+    int nrOfWords_;
+    std::vector<uint64_t> feasibleBinMasks_;
+
+    /**
+     * @brief Checks if the item type fits in the bin in one of its allowed rotations.
+     *
+     * If all rotations are allowed, the sorted dimensions of the item have to fit in the sorted dimensions of the bin.
+     *
+     * @param aItemType
+     * @param aSortedItemDimensions
+     * @param aRequestedBin
+     * @param aSortedBinDimensions
+     * @return true
+     * @return false
+     */
+    static const bool fitsInSomeRotation(const std::shared_ptr<Item> &aItemType,
+                                         const std::array<int, 3> &aSortedItemDimensions,
+                                         const std::shared_ptr<RequestedBin> &aRequestedBin,
+                                         const std::array<int, 3> &aSortedBinDimensions)
+    {
+        if (aItemType->Item::weight_ > aRequestedBin->getMaxWeight())
+        {
+            return false;
+        };
+
+        bool allRotationsAllowed = true;
+        for (char rotationType = '0'; rotationType <= '5'; rotationType++)
+        {
+            allRotationsAllowed = allRotationsAllowed && aItemType->Item::allowedRotations_.find(rotationType) != std::string::npos;
+        };
+
+        if (allRotationsAllowed)
+        {
+            return aSortedItemDimensions[0] <= aSortedBinDimensions[0] &&
+                   aSortedItemDimensions[1] <= aSortedBinDimensions[1] &&
+                   aSortedItemDimensions[2] <= aSortedBinDimensions[2];
+        };
+
+        for (const char rotationType : aItemType->Item::allowedRotations_)
+        {
+            const std::array<int, 3> dimensions = FeasibilityIndex::getRotatedDimensions(aItemType, rotationType - '0');
+            if (dimensions[constants::axis::WIDTH] <= aRequestedBin->getWidth() &&
+                dimensions[constants::axis::DEPTH] <= aRequestedBin->getDepth() &&
+                dimensions[constants::axis::HEIGHT] <= aRequestedBin->getHeight())
+            {
+                return true;
+            };
+        };
+
+        return false;
+    }
+
+public:
+    /**
+     * @brief Get the dimensions of an item type in a rotation, without rotating the item.
+     *
+     * Unknown rotation types leave an item in its current rotation, for an item type that is the unrotated state.
+     *
+     * @param aItemType
+     * @param aRotationType
+     * @return const std::array<int, 3>
+     */
+    static const std::array<int, 3> getRotatedDimensions(const std::shared_ptr<Item> &aItemType, const int aRotationType)
+    {
+        const int width = aItemType->Item::original_width_;
+        const int depth = aItemType->Item::original_depth_;
+        const int height = aItemType->Item::original_height_;
+
+        switch (aRotationType)
+        {
+        case constants::rotation::type::DWH:
+            return {depth, width, height};
+        case constants::rotation::type::HDW:
+            return {height, depth, width};
+        case constants::rotation::type::DHW:
+            return {depth, height, width};
+        case constants::rotation::type::HWD:
+            return {height, width, depth};
+        case constants::rotation::type::WHD:
+            return {width, height, depth};
+        default:
+            return {width, depth, height};
+        };
+    }
+
+    /**
+     * @brief Build the index.
+     *
+     * @param aItemTypes item types indexed by item type id, ids without item type may hold a nullptr.
+     * @param aRequestedBins
+     * @param aNrOfBinTypes number of bin type ids, bins are indexed by their type id.
+     */
+    FeasibilityIndex(const std::vector<std::shared_ptr<Item>> &aItemTypes,
+                     const std::vector<std::shared_ptr<RequestedBin>> &aRequestedBins,
+                     const int aNrOfBinTypes) : nrOfWords_(aNrOfBinTypes / 64 + 1)
+    {
+        FeasibilityIndex::feasibleBinMasks_.assign(aItemTypes.size() * FeasibilityIndex::nrOfWords_, 0);
+
+        std::vector<std::array<int, 3>> sortedBinDimensions;
+        for (const std::shared_ptr<RequestedBin> &requestedBin : aRequestedBins)
+        {
+            std::array<int, 3> binDimensions = {requestedBin->getWidth(), requestedBin->getDepth(), requestedBin->getHeight()};
+            std::sort(binDimensions.begin(), binDimensions.end());
+            sortedBinDimensions.push_back(binDimensions);
+        };
+
+        for (int itemTypeId = 0; itemTypeId < (int)aItemTypes.size(); itemTypeId++)
+        {
+            const std::shared_ptr<Item> &itemType = aItemTypes[itemTypeId];
+            if (!itemType)
+            {
+                continue;
+            };
+
+            std::array<int, 3> itemDimensions = {itemType->Item::original_width_, itemType->Item::original_depth_, itemType->Item::original_height_};
+            std::sort(itemDimensions.begin(), itemDimensions.end());
+
+            for (int idx = 0; idx < (int)aRequestedBins.size(); idx++)
+            {
+                if (FeasibilityIndex::fitsInSomeRotation(itemType, itemDimensions, aRequestedBins[idx], sortedBinDimensions[idx]))
+                {
+                    const int binTypeId = aRequestedBins[idx]->getTypeId();
+                    FeasibilityIndex::feasibleBinMasks_[(size_t)itemTypeId * FeasibilityIndex::nrOfWords_ + binTypeId / 64] |= uint64_t(1) << (binTypeId % 64);
+                };
+            };
+        };
+    };
+
+    /**
+     * @brief Checks if an item type fits in a bin type in some allowed rotation.
+     *
+     * @param aItemTypeId
+     * @param aBinTypeId
+     * @return true
+     * @return false
+     */
+    const bool fits(const int aItemTypeId, const int aBinTypeId) const
+    {
+        return (FeasibilityIndex::feasibleBinMasks_[(size_t)aItemTypeId * FeasibilityIndex::nrOfWords_ + aBinTypeId / 64] >> (aBinTypeId % 64)) & 1;
+    }
+};
+
+#endif
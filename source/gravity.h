@@ -271,6 +271,19 @@ public:
         return highLevelGravityEnabled_ || aItem->gravityStrength_ > 0.0;
     }
 
+    /**
+     * @brief Returns true if gravity should be checked for any of the items.
+     *
+     * @param aItemKeys
+     * @return true
+     * @return false
+     */
+    const bool gravityEnabledForAny(const std::vector<int> &aItemKeys) const
+    {
+        return highLevelGravityEnabled_ || std::any_of(aItemKeys.begin(), aItemKeys.end(), [this](const int itemKey)
+                                                       { return Gravity::itemRegister_->peekItem(itemKey)->gravityStrength_ > 0.0; });
+    }
+
     /**
      * @brief Checks if the item obeys gravity constraints.
      *
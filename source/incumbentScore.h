@@ -0,0 +1,55 @@
+#ifndef INCUMBENT_SCORE_H
+#define INCUMBENT_SCORE_H
+
+/**
+ * @brief Best score of the packers that finished and can win, shared by the packers of one compose round.
+ *
+ * A lower score is better, on equal scores the packer with the lower rank wins. Packers that can no longer
+ * beat the incumbent stop packing. Ranks keep the outcome independent of the order in which packers finish.
+ *
+ */
+class IncumbentScore
+{
+private:
+    mutable std::mutex mutex_;
+    double score_;
+    int rank_;
+
+    const bool isBetter(const double aScore, const int aRank) const { return aScore < IncumbentScore::score_ || (aScore == IncumbentScore::score_ && aRank < IncumbentScore::rank_); };
+
+public:
+    IncumbentScore() : score_(std::numeric_limits<double>::max()),
+                       rank_(std::numeric_limits<int>::max()){};
+
+    /**
+     * @brief Offer the score of a finished packer, it becomes the incumbent score if it is better.
+     *
+     * @param aScore
+     * @param aRank
+     */
+    void offer(const double aScore, const int aRank)
+    {
+        std::lock_guard<std::mutex> lock(IncumbentScore::mutex_);
+        if (IncumbentScore::isBetter(aScore, aRank))
+        {
+            IncumbentScore::score_ = aScore;
+            IncumbentScore::rank_ = aRank;
+        };
+    }
+
+    /**
+     * @brief Checks if a score of a packer with the given rank beats the incumbent score.
+     *
+     * @param aScore
+     * @param aRank
+     * @return true
+     * @return false
+     */
+    const bool isBeatenBy(const double aScore, const int aRank) const
+    {
+        std::lock_guard<std::mutex> lock(IncumbentScore::mutex_);
+        return IncumbentScore::isBetter(aScore, aRank);
+    };
+};
+
+#endif
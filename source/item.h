@@ -4,32 +4,15 @@
 class Item : public GeometricShape
 {
 
-private:
-  void setStackingStyle(std::string aStackingStyle)
-  {
-    std::transform(aStackingStyle.begin(), aStackingStyle.end(), aStackingStyle.begin(), ::toupper);
-
-    if (aStackingStyle == constants::item::parameter::BOTTOM_NO_ITEMS_ON_TOP)
-    {
-      Item::stackingStyle_ = constants::item::parameter::BOTTOM_NO_ITEMS_ON_TOP;
-    }
-    else if (aStackingStyle == constants::item::parameter::NO_ITEMS_ON_TOP)
-    {
-      Item::stackingStyle_ = constants::item::parameter::NO_ITEMS_ON_TOP;
-    }
-    else
-    {
-      Item::stackingStyle_ = constants::item::parameter::ALLOW_ALL;
-    };
-  }
-
 public:
   std::string id_;
   int transientSysId_;
+  int itemTypeId_;
   double weight_;
   std::string itemConsolidationKey_;
+  int itemConsolidationKeyId_;
   double gravityStrength_;
-  std::string stackingStyle_;
+  int stackingStyle_;
   std::vector<std::string> compatibleBins_;
 
   Item(int aSystemId,
@@ -42,19 +25,53 @@ public:
        std::string aAllowedRotations,
        double aGravityStrength,
        std::vector<std::string> aCompatibleBins,
-       std::string aStackingStyle) : transientSysId_(aSystemId),
+       int aStackingStyle) : transientSysId_(aSystemId),
+                                     itemTypeId_(-1),
                                      weight_(aWeight),
                                      itemConsolidationKey_(aItemConsKey),
+                                     itemConsolidationKeyId_(-1),
                                      gravityStrength_(aGravityStrength),
+                                     stackingStyle_(aStackingStyle),
                                      compatibleBins_(aCompatibleBins),
                                      GeometricShape(aWidth, aDepth, aHeight, aAllowedRotations)
   {
     id_ = aItemId.size() ? aItemId : "NA";
-    setStackingStyle(aStackingStyle);
   };
 
+  /**
+   * @brief Get the stacking style belonging to the stacking style text of a request.
+   *
+   * @param aStackingStyle
+   * @return const int
+   */
+  static const int getStackingStyle(std::string aStackingStyle)
+  {
+    std::transform(aStackingStyle.begin(), aStackingStyle.end(), aStackingStyle.begin(), ::toupper);
+
+    if (aStackingStyle == constants::item::parameter::BOTTOM_NO_ITEMS_ON_TOP)
+    {
+      return constants::item::stackingStyle::BOTTOM_NO_ITEMS_ON_TOP;
+    }
+    else if (aStackingStyle == constants::item::parameter::NO_ITEMS_ON_TOP)
+    {
+      return constants::item::stackingStyle::NO_ITEMS_ON_TOP;
+    };
+
+    return constants::item::stackingStyle::ALLOW_ALL;
+  }
+
   const double getRealWeight() const { return weight_; };
 
+  /**
+   * @brief Return boolean indicating if the item still has the attributes of its item type.
+   *
+   * Items without an item type id, or rotated items, have to be compared attribute by attribute.
+   *
+   * @return true
+   * @return false
+   */
+  const bool hasItemTypeAttributes() const { return Item::itemTypeId_ >= 0 && Item::rotationType_ == constants::rotation::type::WDH; };
+
   /**
    * @brief Changes the attributes of the item according to the desired
    * rotation.
@@ -88,8 +105,8 @@ public:
    * @return true
    * @return false
    */
-  const bool doesNotAllowItemsOnTop() const { return Item::stackingStyle_ == constants::item::parameter::BOTTOM_NO_ITEMS_ON_TOP ||
-                                                     Item::stackingStyle_ == constants::item::parameter::NO_ITEMS_ON_TOP; };
+  const bool doesNotAllowItemsOnTop() const { return Item::stackingStyle_ == constants::item::stackingStyle::BOTTOM_NO_ITEMS_ON_TOP ||
+                                                     Item::stackingStyle_ == constants::item::stackingStyle::NO_ITEMS_ON_TOP; };
 };
 
 #endif
@@ -14,80 +14,93 @@ class ItemPositionConstructor
 {
 private:
     std::vector<int> items_;
-    std::map<int, std::vector<int>> distinctItems_;
+    std::vector<std::vector<int>> distinctItems_;
+    std::vector<int> distinctItemKeys_;
+    std::map<int, int> distinctItemIndexes_;
+    std::unordered_map<int, int> itemDistinctItemIndexes_;
+    std::unordered_map<int, int> itemOrder_;
     std::shared_ptr<PackingContext> context_;
     std::shared_ptr<Bin2D> precalculatedBin_;
     int heightAddition_;
+    int nrOfItemsWithNoItemsOnTopStackingStyle_;
     bool hasPrecalculatedBinAvailable_;
     bool containsItemsWithNoItemsOnTopStackingStyle_;
     double minimumSurfaceArea_ = 74.0;
 
     /**
-     * @brief Create a map of unique items.
+     * @brief Create the groups of unique items.
      *
-     * The key is the key of the first unique item of that kind.
+     * Items are loosely equal if their dimensions are equal, so the dimensions identify the group in a single pass.
+     * The key of a group is the key of the first unique item of that kind.
      * The values are then the keys of the items which are equal to the first one.
      *
      */
     void filterDistinctItems()
     {
-        for (const int &itemKey : ItemPositionConstructor::items_)
+        std::map<std::array<int, 3>, int> distinctItemIndexByDimensions;
+
+        for (int idx = 0; idx < (int)ItemPositionConstructor::items_.size(); idx++)
         {
-            if (ItemPositionConstructor::distinctItems_.empty())
-            {
-                ItemPositionConstructor::distinctItems_[itemKey] = {itemKey};
-            }
-            else
+            const int itemKey = ItemPositionConstructor::items_[idx];
+            const std::shared_ptr<Item> &item = context_->peekItem(itemKey);
+
+            const std::pair<std::map<std::array<int, 3>, int>::iterator, bool> distinctItem =
+                distinctItemIndexByDimensions.emplace(std::array<int, 3>{item->width_, item->depth_, item->height_}, (int)ItemPositionConstructor::distinctItems_.size());
+
+            if (distinctItem.second)
             {
-                bool isDistinct = true;
-                for (std::map<int, std::vector<int>>::iterator mapIterator = distinctItems_.begin(); mapIterator != distinctItems_.end(); ++mapIterator)
-                {
-                    if (ItemPositionConstructor::context_->getItemRegister()->itemsAreLooselyEqual(itemKey, mapIterator->first))
-                    {
-                        isDistinct = false;
-                        mapIterator->second.push_back(itemKey);
-                        break;
-                    };
-                }
-                if (isDistinct)
-                {
-                    ItemPositionConstructor::distinctItems_[itemKey] = {itemKey};
-                }
-            }
+                ItemPositionConstructor::distinctItems_.push_back({});
+                ItemPositionConstructor::distinctItemKeys_.push_back(itemKey);
+                ItemPositionConstructor::distinctItemIndexes_[itemKey] = distinctItem.first->second;
+            };
 
-            ItemPositionConstructor::setContainsItemsWithNoItemsOnTopStackingStyle(itemKey);
+            ItemPositionConstructor::distinctItems_[distinctItem.first->second].push_back(itemKey);
+            ItemPositionConstructor::itemDistinctItemIndexes_[itemKey] = distinctItem.first->second;
+            ItemPositionConstructor::itemOrder_[itemKey] = idx;
+
+            if (item->stackingStyle_ == constants::item::stackingStyle::BOTTOM_NO_ITEMS_ON_TOP)
+            {
+                ItemPositionConstructor::nrOfItemsWithNoItemsOnTopStackingStyle_++;
+            };
         }
+
+        ItemPositionConstructor::containsItemsWithNoItemsOnTopStackingStyle_ = ItemPositionConstructor::nrOfItemsWithNoItemsOnTopStackingStyle_ > 0;
     }
 
     /**
-     * @brief Set sontainsItemsWithNoItemsOnTopStackingStyle_
-     *
-     * If already true, keep true.
-     * If false, check the provided item.
+     * @brief If the calculated layer contains items with a bottomNoItemsUp stacking style, they should be placed first.
      *
-     * @param aItemKey
      */
-    void setContainsItemsWithNoItemsOnTopStackingStyle(const int aItemKey)
+    void sortDistinctItems()
     {
-
-        if (ItemPositionConstructor::containsItemsWithNoItemsOnTopStackingStyle_)
+        for (std::vector<int> &distinctItems : ItemPositionConstructor::distinctItems_)
         {
-            return;
-        }
-
-        ItemPositionConstructor::containsItemsWithNoItemsOnTopStackingStyle_ = (context_->getItemRegister()->getConstItem(aItemKey)->stackingStyle_ == constants::item::parameter::BOTTOM_NO_ITEMS_ON_TOP);
-    };
+            context_->getItemRegister()->moveBottomNoItemsUpToBackOfVector(distinctItems);
+        };
+    }
 
     /**
-     * @brief If the calculated layer contains items with a bottomNoItemsUp stacking style, they should be placed first.
+     * @brief Returns the key of the item which came first in the original item order.
      *
+     * The items of a group are in the original item order, apart from the bottomNoItemsUp items which were moved to the back.
+     * So the first item is either the first item of the group or the first bottomNoItemsUp item.
+     *
+     * @param aDistinctItems
+     * @return const int
      */
-    void sortDistinctItems()
+    const int getFirstItemKey(const std::vector<int> &aDistinctItems) const
     {
-        for (std::map<int, std::vector<int>>::iterator distinctItemInfo = distinctItems_.begin(); distinctItemInfo != distinctItems_.end(); ++distinctItemInfo)
+        const std::vector<int>::const_iterator firstBottomNoItemsOnTopItem =
+            std::partition_point(aDistinctItems.begin(), aDistinctItems.end(), [this](const int itemKey)
+                                 { return context_->peekItem(itemKey)->stackingStyle_ != constants::item::stackingStyle::BOTTOM_NO_ITEMS_ON_TOP; });
+
+        if (firstBottomNoItemsOnTopItem == aDistinctItems.end() ||
+            ItemPositionConstructor::itemOrder_.at(aDistinctItems.front()) < ItemPositionConstructor::itemOrder_.at(*firstBottomNoItemsOnTopItem))
         {
-            context_->getItemRegister()->moveBottomNoItemsUpToBackOfVector(distinctItemInfo->second);
+            return aDistinctItems.front();
         };
+
+        return *firstBottomNoItemsOnTopItem;
     }
 
     /**
@@ -113,17 +126,18 @@ private:
     const std::shared_ptr<Item> createBaseItem(const int aItemKey) const
     {
         const std::vector<std::string> compatibleBins;
+        const std::shared_ptr<Item> &item = context_->peekItem(aItemKey);
         return std::make_shared<Item>(BASE_ITEM_KEY,
-                                      std::to_string(context_->getItem(aItemKey)->transientSysId_),
-                                      context_->getItem(aItemKey)->width_,
-                                      context_->getItem(aItemKey)->depth_,
-                                      context_->getItem(aItemKey)->height_,
-                                      context_->getItem(aItemKey)->weight_,
+                                      std::to_string(aItemKey),
+                                      item->width_,
+                                      item->depth_,
+                                      item->height_,
+                                      item->weight_,
                                       "none",
                                       "01",
-                                      context_->getItem(aItemKey)->gravityStrength_,
+                                      item->gravityStrength_,
                                       compatibleBins,
-                                      context_->getItem(aItemKey)->stackingStyle_);
+                                      item->stackingStyle_);
     }
 
     /**
@@ -135,21 +149,21 @@ private:
 
         int winningSurfaceArea = 0;
 
-        for (std::map<int, std::vector<int>>::iterator distinctItemInfo = distinctItems_.begin(); distinctItemInfo != distinctItems_.end(); ++distinctItemInfo)
+        for (std::map<int, int>::iterator distinctItemInfo = distinctItemIndexes_.begin(); distinctItemInfo != distinctItemIndexes_.end(); ++distinctItemInfo)
         {
-
+            const std::vector<int> &distinctItems = ItemPositionConstructor::distinctItems_[distinctItemInfo->second];
             const std::shared_ptr<Item> baseItem = ItemPositionConstructor::createBaseItem(distinctItemInfo->first);
 
             if (ItemPositionConstructor::containsItemsWithNoItemsOnTopStackingStyle_)
             {
-                if (context_->getItemRegister()->getConstItem(distinctItemInfo->second.back())->stackingStyle_ != constants::item::parameter::BOTTOM_NO_ITEMS_ON_TOP)
+                if (context_->peekItem(distinctItems.back())->stackingStyle_ != constants::item::stackingStyle::BOTTOM_NO_ITEMS_ON_TOP)
                 {
                     continue;
                 };
             };
 
             const double itemSurfaceArea = baseItem->getRealBottomSurfaceArea();
-            const int availableItems = (int)distinctItemInfo->second.size();
+            const int availableItems = (int)distinctItems.size();
 
             // Filters without checking if a good layer can be build. Comparison based on percentage.
             if (minimumSurfaceArea_ > ItemPositionConstructor::itemSurfaceCoverage(itemSurfaceArea, availableItems))
@@ -190,7 +204,8 @@ public:
                             const std::vector<int> aItems) : context_(aContext),
                                                              items_(aItems),
                                                              hasPrecalculatedBinAvailable_(false),
-                                                             heightAddition_(0)
+                                                             heightAddition_(0),
+                                                             nrOfItemsWithNoItemsOnTopStackingStyle_(0)
     {
         ItemPositionConstructor::reconfigure(aItems);
     };
@@ -222,7 +237,7 @@ public:
     /// @brief Returns the vector of item keys relevant to this distinct item key.
     /// @param aKey
     /// @return const std::vector<int>
-    const std::vector<int> &getRelevantItems() const { return distinctItems_.at(ItemPositionConstructor::getDistinctItemKey()); };
+    const std::vector<int> &getRelevantItems() const { return distinctItems_[distinctItemIndexes_.at(ItemPositionConstructor::getDistinctItemKey())]; };
 
     /// @brief Get a number of items in the base layer.
     /// @return const int
@@ -241,12 +256,58 @@ public:
     {
         ItemPositionConstructor::items_ = aItems;
         ItemPositionConstructor::hasPrecalculatedBinAvailable_ = false;
-        ItemPositionConstructor::containsItemsWithNoItemsOnTopStackingStyle_ = false;
+        ItemPositionConstructor::nrOfItemsWithNoItemsOnTopStackingStyle_ = 0;
         ItemPositionConstructor::distinctItems_.clear();
+        ItemPositionConstructor::distinctItemKeys_.clear();
+        ItemPositionConstructor::distinctItemIndexes_.clear();
+        ItemPositionConstructor::itemDistinctItemIndexes_.clear();
+        ItemPositionConstructor::itemOrder_.clear();
         ItemPositionConstructor::filterDistinctItems();
         ItemPositionConstructor::sortDistinctItems();
         ItemPositionConstructor::process();
     };
+
+    /**
+     * @brief Remove the packed items from their groups and look for the next layer.
+     *
+     * Only the groups of the packed items are updated, the remaining items are not grouped again.
+     *
+     * @param aPackedItems
+     */
+    void removePackedItems(const std::vector<int> &aPackedItems)
+    {
+        const ItemSet packedItems(aPackedItems);
+        std::set<int> changedDistinctItemIndexes;
+
+        for (const int itemKey : aPackedItems)
+        {
+            changedDistinctItemIndexes.insert(ItemPositionConstructor::itemDistinctItemIndexes_.at(itemKey));
+
+            if (context_->peekItem(itemKey)->stackingStyle_ == constants::item::stackingStyle::BOTTOM_NO_ITEMS_ON_TOP)
+            {
+                ItemPositionConstructor::nrOfItemsWithNoItemsOnTopStackingStyle_--;
+            };
+        };
+
+        for (const int distinctItemIndex : changedDistinctItemIndexes)
+        {
+            std::vector<int> &distinctItems = ItemPositionConstructor::distinctItems_[distinctItemIndex];
+            packedItems.removeFrom(distinctItems);
+
+            ItemPositionConstructor::distinctItemIndexes_.erase(ItemPositionConstructor::distinctItemKeys_[distinctItemIndex]);
+            if (distinctItems.empty())
+            {
+                continue;
+            };
+
+            ItemPositionConstructor::distinctItemKeys_[distinctItemIndex] = ItemPositionConstructor::getFirstItemKey(distinctItems);
+            ItemPositionConstructor::distinctItemIndexes_[ItemPositionConstructor::distinctItemKeys_[distinctItemIndex]] = distinctItemIndex;
+        };
+
+        ItemPositionConstructor::hasPrecalculatedBinAvailable_ = false;
+        ItemPositionConstructor::containsItemsWithNoItemsOnTopStackingStyle_ = ItemPositionConstructor::nrOfItemsWithNoItemsOnTopStackingStyle_ > 0;
+        ItemPositionConstructor::process();
+    };
 };
 
 #endif
@@ -0,0 +1,172 @@
+#ifndef ITEM_SET_H
+#define ITEM_SET_H
+
+/**
+ * @brief Set of item keys stored as a dense bitset, one bit per item key.
+ *
+ * Item keys are small consecutive integers, so membership is a bit test and difference and union run a word at a time.
+ * Iterating the set visits the item keys in ascending order.
+ *
+ */
+class ItemSet
+{
+private:
+    std::vector<uint64_t> words_;
+
+public:
+    ItemSet(){};
+
+    ItemSet(const std::vector<int> &aItemKeys)
+    {
+        ItemSet::insert(aItemKeys);
+    };
+
+    /**
+     * @brief Add an item key to the set.
+     *
+     * @param aItemKey
+     */
+    void insert(const int aItemKey)
+    {
+        if (aItemKey / 64 >= (int)ItemSet::words_.size())
+        {
+            ItemSet::words_.resize(aItemKey / 64 + 1, 0);
+        };
+        ItemSet::words_[aItemKey / 64] |= uint64_t(1) << (aItemKey % 64);
+    }
+
+    /**
+     * @brief Add item keys to the set.
+     *
+     * @param aItemKeys
+     */
+    void insert(const std::vector<int> &aItemKeys)
+    {
+        if (!aItemKeys.empty())
+        {
+            const int maxItemKey = *std::max_element(aItemKeys.begin(), aItemKeys.end());
+            if (maxItemKey / 64 >= (int)ItemSet::words_.size())
+            {
+                ItemSet::words_.resize(maxItemKey / 64 + 1, 0);
+            };
+        };
+
+        for (const int itemKey : aItemKeys)
+        {
+            ItemSet::words_[itemKey / 64] |= uint64_t(1) << (itemKey % 64);
+        };
+    }
+
+    /**
+     * @brief Remove an item key from the set.
+     *
+     * @param aItemKey
+     */
+    void erase(const int aItemKey)
+    {
+        if (aItemKey / 64 < (int)ItemSet::words_.size())
+        {
+            ItemSet::words_[aItemKey / 64] &= ~(uint64_t(1) << (aItemKey % 64));
+        };
+    }
+
+    /**
+     * @brief Checks if an item key is in the set.
+     *
+     * @param aItemKey
+     * @return true
+     * @return false
+     */
+    const bool contains(const int aItemKey) const
+    {
+        return aItemKey / 64 < (int)ItemSet::words_.size() && (ItemSet::words_[aItemKey / 64] >> (aItemKey % 64)) & 1;
+    }
+
+    /**
+     * @brief Add all item keys of another set.
+     *
+     * @param aItemSet
+     */
+    void unite(const ItemSet &aItemSet)
+    {
+        if (aItemSet.words_.size() > ItemSet::words_.size())
+        {
+            ItemSet::words_.resize(aItemSet.words_.size(), 0);
+        };
+
+        for (int idx = 0; idx < (int)aItemSet.words_.size(); idx++)
+        {
+            ItemSet::words_[idx] |= aItemSet.words_[idx];
+        };
+    }
+
+    /**
+     * @brief Remove all item keys of another set.
+     *
+     * @param aItemSet
+     */
+    void subtract(const ItemSet &aItemSet)
+    {
+        const int nrOfWords = std::min(ItemSet::words_.size(), aItemSet.words_.size());
+        for (int idx = 0; idx < nrOfWords; idx++)
+        {
+            ItemSet::words_[idx] &= ~aItemSet.words_[idx];
+        };
+    }
+
+    /**
+     * @brief Get the number of item keys in the set.
+     *
+     * @return const int
+     */
+    const int size() const
+    {
+        int nrOfItemKeys = 0;
+        for (const uint64_t word : ItemSet::words_)
+        {
+            nrOfItemKeys += __builtin_popcountll(word);
+        };
+        return nrOfItemKeys;
+    }
+
+    const bool empty() const
+    {
+        return std::all_of(ItemSet::words_.begin(), ItemSet::words_.end(), [](const uint64_t word)
+                           { return word == 0; });
+    }
+
+    /**
+     * @brief Get the item keys in ascending order.
+     *
+     * @return const std::vector<int>
+     */
+    const std::vector<int> getItemKeys() const
+    {
+        std::vector<int> itemKeys;
+        itemKeys.reserve(ItemSet::size());
+
+        for (int idx = 0; idx < (int)ItemSet::words_.size(); idx++)
+        {
+            for (uint64_t word = ItemSet::words_[idx]; word; word &= word - 1)
+            {
+                itemKeys.push_back(idx * 64 + __builtin_ctzll(word));
+            };
+        };
+
+        return itemKeys;
+    }
+
+    /**
+     * @brief Remove the item keys which are in the set from a vector, the order of the vector is kept.
+     *
+     * @param aItemKeys
+     */
+    void removeFrom(std::vector<int> &aItemKeys) const
+    {
+        aItemKeys.erase(std::remove_if(aItemKeys.begin(), aItemKeys.end(), [this](const int itemKey)
+                                       { return ItemSet::contains(itemKey); }),
+                        aItemKeys.end());
+    }
+};
+
+#endif
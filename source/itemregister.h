@@ -5,9 +5,59 @@ struct ItemRegister
 {
 private:
     std::string sortMethod_;
-    std::vector<std::shared_ptr<Item>> completeItemVector_;
     std::vector<int> completeItemKeyVector_;
-    std::unordered_map<int, std::shared_ptr<Item>> completeItemMap_;
+    std::vector<std::shared_ptr<Item>> itemTypes_;
+    mutable std::vector<std::shared_ptr<Item>> expandedItems_;
+    std::map<std::tuple<int, int, int, double, std::string, int, double, std::vector<std::string>>, int> itemTypeIds_;
+    StringRegister itemConsolidationKeys_;
+    mutable std::vector<std::vector<int>> itemKeysPerConsKey_;
+
+    /**
+     * @brief Make sure the item key fits in the key indexed vectors.
+     *
+     * @param aItemKey
+     */
+    void reserveItemKey(const int aItemKey)
+    {
+        if (aItemKey >= (int)ItemRegister::itemTypes_.size())
+        {
+            ItemRegister::itemTypes_.resize(aItemKey + 1);
+            ItemRegister::expandedItems_.resize(aItemKey + 1);
+        };
+    }
+
+    /**
+     * @brief Create the item object of an item which so far only existed as a quantity of its item type.
+     *
+     * @param aItemKey
+     */
+    void expandItem(const int aItemKey) const
+    {
+        ItemRegister::expandedItems_[aItemKey] = std::make_shared<Item>(*ItemRegister::itemTypes_[aItemKey]);
+        ItemRegister::expandedItems_[aItemKey]->Item::transientSysId_ = aItemKey;
+    }
+
+    /**
+     * @brief Give the item type a dense id, item types with equal dimensions, weight, allowed rotations, stacking style, gravity strength and compatible bins share the same id.
+     *
+     * @param aItemType
+     */
+    void assignItemTypeId(const std::shared_ptr<Item> &aItemType)
+    {
+        std::vector<std::string> compatibleBins = aItemType->Item::compatibleBins_;
+        std::sort(compatibleBins.begin(), compatibleBins.end());
+
+        const std::tuple<int, int, int, double, std::string, int, double, std::vector<std::string>> itemTypeAttributes = {aItemType->Item::original_width_,
+                                                                                                                         aItemType->Item::original_depth_,
+                                                                                                                         aItemType->Item::original_height_,
+                                                                                                                         aItemType->Item::weight_,
+                                                                                                                         aItemType->Item::allowedRotations_,
+                                                                                                                         aItemType->Item::stackingStyle_,
+                                                                                                                         aItemType->Item::gravityStrength_,
+                                                                                                                         compatibleBins};
+
+        aItemType->Item::itemTypeId_ = ItemRegister::itemTypeIds_.emplace(itemTypeAttributes, (int)ItemRegister::itemTypeIds_.size()).first->second;
+    }
 
     /**
      * @brief Set the main sort method for the packer.
@@ -34,97 +84,120 @@ private:
         };
     }
 
+    /**
+     * @brief Give the item the id of its itemConsKey, items which already have one keep it.
+     *
+     * @param aItem
+     */
+    void assignItemConsolidationKeyId(const std::shared_ptr<Item> &aItem)
+    {
+        if (aItem->Item::itemConsolidationKeyId_ < 0)
+        {
+            aItem->Item::itemConsolidationKeyId_ = ItemRegister::itemConsolidationKeys_.getId(aItem->Item::itemConsolidationKey_);
+        };
+    }
+
     /**
      * @brief Split the provided items based on itemConsKey.
      *
+     * The groups are ordered on itemConsKey id, the items keep their order within a group.
+     *
      * @param aItemVector
      * @return const std::vector<std::vector<int>>
      */
-    const std::vector<std::vector<int>> splitItemsByConsKey(std::vector<int> aItemKeyVector) const
+    const std::vector<std::vector<int>> splitItemsByConsKey(const std::vector<int> &aItemKeyVector) const
     {
-
-        std::sort(aItemKeyVector.begin(), aItemKeyVector.end(), [this](int &itemKeyLeft, int &itemKeyRight)
-                  { return ItemRegister::getConstItem(itemKeyLeft)->itemConsolidationKey_ < ItemRegister::getConstItem(itemKeyRight)->itemConsolidationKey_; });
-
-        std::vector<std::vector<int>> FinalSortedItemConsKeyVectors = {std::vector<int>{getConstItem(aItemKeyVector.front())->Item::transientSysId_}};
-
-        for (int idx = 1; idx < aItemKeyVector.size(); idx++)
+        int nrOfConsKeys = 0;
+        for (const int itemKey : aItemKeyVector)
         {
-            if (ItemRegister::getConstItem(aItemKeyVector[idx])->itemConsolidationKey_ ==
-                ItemRegister::getConstItem(FinalSortedItemConsKeyVectors.back().back())->Item::itemConsolidationKey_)
-            {
+            nrOfConsKeys = std::max(nrOfConsKeys, ItemRegister::peekItem(itemKey)->itemConsolidationKeyId_ + 1);
+        };
 
-                FinalSortedItemConsKeyVectors.back().push_back(ItemRegister::getConstItem(aItemKeyVector[idx])->Item::transientSysId_);
-            }
-            else
-            {
-                FinalSortedItemConsKeyVectors.push_back(std::vector<int>{ItemRegister::getConstItem(aItemKeyVector[idx])->Item::transientSysId_});
-            };
+        std::vector<std::vector<int>> FinalSortedItemConsKeyVectors(nrOfConsKeys);
+        for (const int itemKey : aItemKeyVector)
+        {
+            FinalSortedItemConsKeyVectors[ItemRegister::peekItem(itemKey)->itemConsolidationKeyId_].push_back(itemKey);
         };
 
+        FinalSortedItemConsKeyVectors.erase(std::remove_if(FinalSortedItemConsKeyVectors.begin(), FinalSortedItemConsKeyVectors.end(), [](const std::vector<int> &itemKeys)
+                                                           { return itemKeys.empty(); }),
+                                            FinalSortedItemConsKeyVectors.end());
+
         return FinalSortedItemConsKeyVectors;
     };
 
     /**
-     * @brief Returns a itemKeyVector sorted according to the sort method of the itemRegister.
+     * @brief Get the items of the register split by itemConsKey.
      *
-     * @param aItemKeyVector
-     * @return const std::vector<int>
+     * The split is made once and kept until items are added to the register.
+     *
+     * @return const std::vector<std::vector<int>>&
      */
-    const std::vector<int> sortItemKeysBySortMethod(std::vector<int> &aItemKeyVector) const
+    const std::vector<std::vector<int>> &getItemKeysPerConsKey() const
     {
+        if (ItemRegister::itemKeysPerConsKey_.empty() && !ItemRegister::completeItemKeyVector_.empty())
+        {
+            ItemRegister::itemKeysPerConsKey_ = ItemRegister::splitItemsByConsKey(ItemRegister::completeItemKeyVector_);
+        };
 
-        ItemRegister::sortMethod_ == constants::itemRegister::parameter::sortMethod::WEIGHT
-            ? ItemRegister::sortItemKeysBasedOnWeight(aItemKeyVector)
-            : ItemRegister::sortItemKeysBasedOnVolume(aItemKeyVector);
-
-        return aItemKeyVector;
+        return ItemRegister::itemKeysPerConsKey_;
     }
 
     /**
-     * @brief Sorts the give itemKeyVector based on the volume of the items inside.
-     * This function modifies the original vector.
+     * @brief Returns a itemKeyVector sorted according to the sort method of the itemRegister.
      *
-     * @param aItemKeyVector
-     */
-    void sortItemKeysBasedOnVolume(std::vector<int> &aItemKeyVector) const
-    {
-        std::sort(aItemKeyVector.begin(), aItemKeyVector.end(), [this](int &itemKeyLeft, int &itemKeyRight)
-                  { return ItemRegister::getConstItem(itemKeyLeft)->volume_ > ItemRegister::getConstItem(itemKeyRight)->volume_ ||
-                           (ItemRegister::getConstItem(itemKeyLeft)->volume_ == ItemRegister::getConstItem(itemKeyRight)->volume_ &&
-                            ItemRegister::getConstItem(itemKeyLeft)->weight_ > ItemRegister::getConstItem(itemKeyRight)->weight_); });
-    }
-
-    /**
-     * @brief Sorts the given itemKeyVector based on the weight of the items inside.
-     * This function modifies the original vector.
+     * Items with the bottomNoItemsOnTop stacking style come first, then the items are sorted descending on volume and weight, or weight and volume.
+     * Remaining ties are ordered on item key. The sort keys are extracted once and radix sorted.
      *
      * @param aItemKeyVector
+     * @return const std::vector<int>
      */
-    void sortItemKeysBasedOnWeight(std::vector<int> &aItemKeyVector) const
+    const std::vector<int> sortItemKeysBySortMethod(std::vector<int> &aItemKeyVector) const
     {
-        std::sort(aItemKeyVector.begin(), aItemKeyVector.end(), [this](int &itemKeyLeft, int &itemKeyRight)
-                  { return ItemRegister::getConstItem(itemKeyLeft)->weight_ > ItemRegister::getConstItem(itemKeyRight)->weight_ ||
-                           (ItemRegister::getConstItem(itemKeyLeft)->weight_ == ItemRegister::getConstItem(itemKeyRight)->weight_ &&
-                            ItemRegister::getConstItem(itemKeyLeft)->volume_ > ItemRegister::getConstItem(itemKeyRight)->volume_); });
+        const bool sortOnWeight = ItemRegister::sortMethod_ == constants::itemRegister::parameter::sortMethod::WEIGHT;
+
+        std::vector<RadixSort::ItemSortKey> sortKeys;
+        sortKeys.reserve(aItemKeyVector.size());
+
+        for (const int itemKey : aItemKeyVector)
+        {
+            const std::shared_ptr<Item> &item = ItemRegister::peekItem(itemKey);
+            const uint64_t volume = RadixSort::orderedBits(item->Item::volume_);
+            const uint64_t weight = RadixSort::orderedBits(item->Item::weight_);
+
+            sortKeys.push_back({{item->Item::stackingStyle_ == constants::item::stackingStyle::BOTTOM_NO_ITEMS_ON_TOP ? uint64_t(0) : uint64_t(1),
+                                 ~(sortOnWeight ? weight : volume),
+                                 ~(sortOnWeight ? volume : weight),
+                                 (uint64_t)itemKey},
+                                itemKey});
+        };
+
+        RadixSort::sort(sortKeys);
+
+        for (int idx = 0; idx < (int)sortKeys.size(); idx++)
+        {
+            aItemKeyVector[idx] = sortKeys[idx].itemKey_;
+        };
+
+        return aItemKeyVector;
     }
 
     /**
      * @brief Get the finalized item key vectors.
      *
-     * This means split per itemConsKey, sorted according to sortMethod, and adjusted for item stackingStyle.
+     * This means split per itemConsKey, sorted according to sortMethod and item stackingStyle.
      *
      * @return const std::vector<std::vector<int>>
      */
-    const std::vector<std::vector<int>> getFinalSortedItemKeys(std::vector<int> aItemKeyVector, const std::string aConsKey) const
+    const std::vector<std::vector<int>> getFinalSortedItemKeys(const int aConsKeyId) const
     {
 
         std::vector<std::vector<int>> sortedByConsKeyAndSortMethod = {};
 
-        for (std::vector<int> itemKeysPerConsKey : ItemRegister::splitItemsByConsKey(aItemKeyVector))
+        for (std::vector<int> itemKeysPerConsKey : ItemRegister::getItemKeysPerConsKey())
         {
-            if (aConsKey != constants::itemRegister::itemConsolidationKey::PO_INTERNAL_ALL &&
-                ItemRegister::getConstItem(itemKeysPerConsKey.front())->itemConsolidationKey_ != aConsKey)
+            if (aConsKeyId != constants::itemRegister::itemConsolidationKey::PO_INTERNAL_ALL &&
+                ItemRegister::peekItem(itemKeysPerConsKey.front())->itemConsolidationKeyId_ != aConsKeyId)
             {
                 continue;
             };
@@ -132,11 +205,6 @@ private:
             sortedByConsKeyAndSortMethod.push_back(ItemRegister::sortItemKeysBySortMethod(itemKeysPerConsKey));
         };
 
-        for (std::vector<int> &itemKeysPerConsKey : sortedByConsKeyAndSortMethod)
-        {
-            moveBottomNoItemsUpToFrontOfVector(itemKeysPerConsKey);
-        }
-
         return sortedByConsKeyAndSortMethod;
     }
 
@@ -144,7 +212,7 @@ public:
     ItemRegister(std::string aSortMethod, unsigned int nrOfItems)
     {
         ItemRegister::setSortMethod(aSortMethod);
-        ItemRegister::completeItemVector_.reserve(nrOfItems);
+        ItemRegister::completeItemKeyVector_.reserve(nrOfItems);
     }
 
     // Set sort method after initialization.
@@ -152,9 +220,13 @@ public:
 
     const std::string &getSortMethod() const { return ItemRegister::sortMethod_; };
 
+    /// @brief Get the number of item type ids handed out by this register.
+    /// @return const int
+    const int getNumberOfItemTypes() const { return (int)ItemRegister::itemTypeIds_.size(); };
+
     /// @brief Get a new, unique, transient item id.
     /// @return const int
-    const int getNewItemId() const { return int(ItemRegister::completeItemVector_.size()); }
+    const int getNewItemId() const { return int(ItemRegister::completeItemKeyVector_.size()); }
 
     /**
      * @brief Add item to the register.
@@ -163,17 +235,63 @@ public:
      */
     inline void addItem(std::shared_ptr<Item> aItem)
     {
-        ItemRegister::completeItemVector_.push_back(aItem);
-        ItemRegister::completeItemKeyVector_.push_back(aItem->Item::transientSysId_);
-        ItemRegister::completeItemMap_.insert(std::make_pair(aItem->Item::transientSysId_, std::move(aItem)));
+        const int itemKey = aItem->Item::transientSysId_;
+        ItemRegister::assignItemConsolidationKeyId(aItem);
+        ItemRegister::reserveItemKey(itemKey);
+        ItemRegister::completeItemKeyVector_.push_back(itemKey);
+        ItemRegister::itemKeysPerConsKey_.clear();
+        ItemRegister::itemTypes_[itemKey] = aItem;
+        ItemRegister::expandedItems_[itemKey] = std::move(aItem);
+    };
+
+    /**
+     * @brief Add an item as one unit of an item type.
+     *
+     * The item object is only created once the item is accessed through getItem or getConstItem,
+     * until then the item type is shared by all its units. The item type must not be modified.
+     * Item types without an item type id or itemConsKey id get them from this register, this happens once while the request is read.
+     *
+     * @param aItemKey
+     * @param aItemType
+     */
+    inline void addItem(const int aItemKey, const std::shared_ptr<Item> &aItemType)
+    {
+        if (aItemType->Item::itemTypeId_ < 0)
+        {
+            ItemRegister::assignItemTypeId(aItemType);
+        };
+        ItemRegister::assignItemConsolidationKeyId(aItemType);
+
+        ItemRegister::reserveItemKey(aItemKey);
+        ItemRegister::completeItemKeyVector_.push_back(aItemKey);
+        ItemRegister::itemKeysPerConsKey_.clear();
+        ItemRegister::itemTypes_[aItemKey] = aItemType;
     };
 
     /**
-     * @brief Get all items.
+     * @brief Get the item type of an item, this is the item in its unpacked state.
+     * For items which were added as item object this is the item object itself.
+     *
+     * @param key
+     * @return const std::shared_ptr<Item>&
+     */
+    const inline std::shared_ptr<Item> &getItemType(const int key) const
+    {
+        return ItemRegister::itemTypes_[key];
+    }
+
+    /**
+     * @brief Get an item for reading without creating its item object.
+     *
+     * Returns the item type if the item has not been accessed yet, its transientSysId_ is then not the key of the item.
      *
-     * @return std::vector<std::shared_ptr<Item>>&
+     * @param key
+     * @return const std::shared_ptr<Item>&
      */
-    std::vector<std::shared_ptr<Item>> &getCompleteItemVector() { return ItemRegister::completeItemVector_; };
+    const inline std::shared_ptr<Item> &peekItem(const int key) const
+    {
+        return ItemRegister::expandedItems_[key] ? ItemRegister::expandedItems_[key] : ItemRegister::itemTypes_[key];
+    }
 
     /**
      * @brief Get a Item object.
@@ -183,7 +301,11 @@ public:
      */
     inline std::shared_ptr<Item> &getItem(const int key)
     {
-        return ItemRegister::completeItemMap_.at(key);
+        if (!ItemRegister::expandedItems_[key])
+        {
+            ItemRegister::expandItem(key);
+        };
+        return ItemRegister::expandedItems_[key];
     }
 
     /**
@@ -194,7 +316,24 @@ public:
      */
     const inline std::shared_ptr<Item> &getConstItem(const int key) const
     {
-        return ItemRegister::completeItemMap_.at(key);
+        if (!ItemRegister::expandedItems_[key])
+        {
+            ItemRegister::expandItem(key);
+        };
+        return ItemRegister::expandedItems_[key];
+    }
+
+    /**
+     * @brief Reset an item, items which have not been accessed yet are still in their initial state.
+     *
+     * @param key
+     */
+    inline void resetItem(const int key)
+    {
+        if (ItemRegister::expandedItems_[key])
+        {
+            ItemRegister::expandedItems_[key]->reset();
+        };
     }
 
     /**
@@ -204,22 +343,50 @@ public:
      */
     const std::vector<std::vector<int>> getNewSortedItemKeys() const
     {
-        return ItemRegister::getFinalSortedItemKeys(ItemRegister::completeItemKeyVector_, constants::itemRegister::itemConsolidationKey::PO_INTERNAL_ALL);
+        return ItemRegister::getFinalSortedItemKeys(constants::itemRegister::itemConsolidationKey::PO_INTERNAL_ALL);
     };
 
     /**
-     * @brief Get the itemKey vector for a specific item consolidation key.
+     * @brief Get the itemKey vector for a specific item consolidation key id.
      *
      * @return const std::vector<int>
      */
-    const std::vector<int> getNewSortedItemKeysForKey(const std::string aItemConsolidationKey) const
+    const std::vector<int> getNewSortedItemKeysForKey(const int aItemConsolidationKeyId) const
     {
-        return ItemRegister::getFinalSortedItemKeys(ItemRegister::completeItemKeyVector_, aItemConsolidationKey).front();
+        return ItemRegister::getFinalSortedItemKeys(aItemConsolidationKeyId).front();
+    };
+
+    /**
+     * @brief Renumber the itemConsKey ids in the order of the itemConsKeys.
+     *
+     * The ids are handed out in order of appearance, after this call comparing ids gives the same result as comparing the itemConsKeys.
+     * Only to be called on the register which handed out the ids, before the items get packed.
+     *
+     */
+    void orderItemConsolidationKeys()
+    {
+        const std::vector<int> newIds = ItemRegister::itemConsolidationKeys_.sort();
+        std::unordered_set<const Item *> renumberedItems;
+
+        for (const std::vector<std::shared_ptr<Item>> *items : {&(ItemRegister::itemTypes_), &(ItemRegister::expandedItems_)})
+        {
+            for (const std::shared_ptr<Item> &item : *items)
+            {
+                if (item && renumberedItems.insert(item.get()).second)
+                {
+                    item->Item::itemConsolidationKeyId_ = newIds[item->Item::itemConsolidationKeyId_];
+                };
+            };
+        };
+
+        ItemRegister::itemKeysPerConsKey_.clear();
     };
 
     /**
      * @brief Checks if two items are equal.
      *
+     * Items which still have the attributes of their item type are equal if their item type ids are equal.
+     *
      * @param aItemToCompare1
      * @param aItemToCompare2
      * @return true
@@ -227,8 +394,14 @@ public:
      */
     const bool itemsAreEqual(const int aItemToCompare1, const int aItemToCompare2) const
     {
-        const std::shared_ptr<Item> itemToCompare1 = ItemRegister::getConstItem(aItemToCompare1);
-        const std::shared_ptr<Item> itemToCompare2 = ItemRegister::getConstItem(aItemToCompare2);
+        const std::shared_ptr<Item> &itemToCompare1 = ItemRegister::peekItem(aItemToCompare1);
+        const std::shared_ptr<Item> &itemToCompare2 = ItemRegister::peekItem(aItemToCompare2);
+
+        if (itemToCompare1->Item::hasItemTypeAttributes() && itemToCompare2->Item::hasItemTypeAttributes())
+        {
+            return itemToCompare1->Item::itemTypeId_ == itemToCompare2->Item::itemTypeId_;
+        };
+
         return (itemToCompare2->Item::width_ == itemToCompare1->Item::width_ &&
                 itemToCompare2->Item::depth_ == itemToCompare1->Item::depth_ &&
                 itemToCompare2->Item::height_ == itemToCompare1->Item::height_ &&
@@ -249,8 +422,8 @@ public:
      */
     const bool itemsAreLooselyEqual(const int aItemToCompare1, const int aItemToCompare2) const
     {
-        const std::shared_ptr<Item> itemToCompare1 = ItemRegister::getConstItem(aItemToCompare1);
-        const std::shared_ptr<Item> itemToCompare2 = ItemRegister::getConstItem(aItemToCompare2);
+        const std::shared_ptr<Item> itemToCompare1 = ItemRegister::peekItem(aItemToCompare1);
+        const std::shared_ptr<Item> itemToCompare2 = ItemRegister::peekItem(aItemToCompare2);
         return (itemToCompare2->Item::width_ == itemToCompare1->Item::width_ &&
                 itemToCompare2->Item::depth_ == itemToCompare1->Item::depth_ &&
                 itemToCompare2->Item::height_ == itemToCompare1->Item::height_);
@@ -265,14 +438,14 @@ public:
     {
         std::unordered_map<std::string, double> volumeMap;
 
-        for (const std::vector<int> itemVector : ItemRegister::getNewSortedItemKeys())
+        for (const std::vector<int> &itemVector : ItemRegister::getItemKeysPerConsKey())
         {
-            const std::string key = ItemRegister::getConstItem(itemVector.front())->itemConsolidationKey_;
+            const std::string &key = ItemRegister::peekItem(itemVector.front())->itemConsolidationKey_;
 
             volumeMap[key] = 0.0;
             for (const int aItemKey : itemVector)
             {
-                volumeMap[key] += ItemRegister::getConstItem(aItemKey)->getRealVolume();
+                volumeMap[key] += ItemRegister::peekItem(aItemKey)->getRealVolume();
             }
         };
 
@@ -288,14 +461,14 @@ public:
     {
         std::unordered_map<std::string, double> weightMap;
 
-        for (const std::vector<int> itemVector : ItemRegister::getNewSortedItemKeys())
+        for (const std::vector<int> &itemVector : ItemRegister::getItemKeysPerConsKey())
         {
-            const std::string key = ItemRegister::getConstItem(itemVector.front())->itemConsolidationKey_;
+            const std::string &key = ItemRegister::peekItem(itemVector.front())->itemConsolidationKey_;
 
             weightMap[key] = 0.0;
             for (const int aItemKey : itemVector)
             {
-                weightMap[key] += ItemRegister::getConstItem(aItemKey)->getRealWeight();
+                weightMap[key] += ItemRegister::peekItem(aItemKey)->getRealWeight();
             }
         };
 
@@ -313,7 +486,7 @@ public:
         bool containsItem = false;
         for (const int itemKey : aItemKeysToBeChecked)
         {
-            if (ItemRegister::getConstItem(itemKey)->stackingStyle_ != constants::item::parameter::ALLOW_ALL)
+            if (ItemRegister::peekItem(itemKey)->stackingStyle_ != constants::item::stackingStyle::ALLOW_ALL)
             {
                 containsItem = true;
                 break;
@@ -334,7 +507,7 @@ public:
         bool containsItem = false;
         for (const int itemKey : aItemKeysToBeChecked)
         {
-            if (ItemRegister::getConstItem(itemKey)->stackingStyle_ == constants::item::parameter::NO_ITEMS_ON_TOP)
+            if (ItemRegister::peekItem(itemKey)->stackingStyle_ == constants::item::stackingStyle::NO_ITEMS_ON_TOP)
             {
                 containsItem = true;
                 break;
@@ -355,7 +528,7 @@ public:
         bool containsItem = false;
         for (const int itemKey : aItemKeysToBeChecked)
         {
-            if (ItemRegister::getConstItem(itemKey)->stackingStyle_ == constants::item::parameter::BOTTOM_NO_ITEMS_ON_TOP)
+            if (ItemRegister::peekItem(itemKey)->stackingStyle_ == constants::item::stackingStyle::BOTTOM_NO_ITEMS_ON_TOP)
             {
                 containsItem = true;
                 break;
@@ -365,28 +538,6 @@ public:
         return containsItem;
     };
 
-    /**
-     * @brief Move items with stacking style bottomNoItemsOnTop to the front of the vector.
-     * This function modifies the original vector.
-     *
-     * @param aItemKeyVector
-     */
-    void moveBottomNoItemsUpToFrontOfVector(std::vector<int> &aItemKeyVector) const
-    {
-        std::vector<int> mustBeBottomNoItemsOnTop = {};
-
-        auto it = aItemKeyVector.begin();
-        while (it != aItemKeyVector.end())
-        {
-            ItemRegister::getConstItem(*it)->Item::stackingStyle_ == constants::item::parameter::BOTTOM_NO_ITEMS_ON_TOP
-                ? mustBeBottomNoItemsOnTop.push_back(*it),
-                it = aItemKeyVector.erase(it)
-                : it++;
-        };
-
-        aItemKeyVector.insert(aItemKeyVector.begin(), mustBeBottomNoItemsOnTop.begin(), mustBeBottomNoItemsOnTop.end());
-    };
-
     /**
      * @brief Move items with stacking style bottomNoItemsOnTop to the back of the vector.
      * This function modifies the original vector.
@@ -395,18 +546,8 @@ public:
      */
     void moveBottomNoItemsUpToBackOfVector(std::vector<int> &aItemKeyVector) const
     {
-        std::vector<int> mustBeBottomNoItemsOnTop = {};
-
-        auto it = aItemKeyVector.begin();
-        while (it != aItemKeyVector.end())
-        {
-            ItemRegister::getConstItem(*it)->Item::stackingStyle_ == constants::item::parameter::BOTTOM_NO_ITEMS_ON_TOP
-                ? mustBeBottomNoItemsOnTop.push_back(*it),
-                it = aItemKeyVector.erase(it)
-                : it++;
-        };
-
-        aItemKeyVector.insert(aItemKeyVector.end(), mustBeBottomNoItemsOnTop.begin(), mustBeBottomNoItemsOnTop.end());
+        std::stable_partition(aItemKeyVector.begin(), aItemKeyVector.end(), [this](const int itemKey)
+                              { return ItemRegister::peekItem(itemKey)->Item::stackingStyle_ != constants::item::stackingStyle::BOTTOM_NO_ITEMS_ON_TOP; });
     };
 };
 
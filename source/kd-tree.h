@@ -257,7 +257,7 @@ public:
      * @param aMaxSearchPoint   - The furthest point in space that an item can be in order to still be considered a intersection candidate.
      * @param aPassedNodes      - The vector to which itemKeys will be added.
      */
-    void getIntersectCandidates(const std::shared_ptr<Node> aRoot,
+    void getIntersectCandidates(const std::shared_ptr<Node> &aRoot,
                                 const int aDepth,
                                 const std::array<int, 3> &aStartPoint,
                                 const std::array<int, 3> aMaxSearchPoint,
@@ -18,6 +18,27 @@ Default parameters.
 #define DEFAULT_RESPONSE_PRECISION 7
 #define DEFAULT_MINIMIZATION_STRATEGY 10
 
+/*
+Threads. Worker threads are shared by all requests, a request uses at most its own number of threads.
+Both can be set per deployment, the defaults pack every request on the calling thread only.
+A request can ask for its own number of threads with maxNrOfThreads in the json or the binary header.
+*/
+#ifndef MAX_NR_OF_WORKER_THREADS
+#define MAX_NR_OF_WORKER_THREADS 0
+#endif
+#ifndef DEFAULT_MAX_THREADS_PER_REQUEST
+#define DEFAULT_MAX_THREADS_PER_REQUEST 1
+#endif
+
+/*
+Sharding. Requests with more items than this are split into shards which are packed on their own, 0 turns sharding off.
+A shard holds at most this many items, so together with the threads per request it bounds the memory of a request.
+A request can set its own shard size with maxNrOfItemsPerShard in the json or the binary header.
+*/
+#ifndef DEFAULT_MAX_NR_OF_ITEMS_PER_SHARD
+#define DEFAULT_MAX_NR_OF_ITEMS_PER_SHARD 0
+#endif
+
 /*
 Compile to a shared object file.
 */
@@ -28,37 +49,101 @@ Compile to a shared object file.
 #define LOCAL_FOLDER "/home/dennismosch/packingOptimizerCompany/algorithms/packToMixedBins"
 #define LOCAL_INPUT_FILE LOCAL_FOLDER "/testfiles/demo.json"
 #define LOCAL_OUTPUT_FILE LOCAL_FOLDER "/output.json"
+#define LOCAL_BINARY_RESULT_BUFFER_SIZE 100000000
 #endif
 
 /*
 Include necessary files.
 */
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
 #include <memory>
+#include <numeric>
+#include <array>
 #include <iostream>
 #include <fstream>
 #include <sstream>
+#include <set>
 #include <stack>
+#include <tuple>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 #include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string_view>
 #include <ext/pb_ds/assoc_container.hpp>
 #include "myjsoncpp/json/json.h"
 #include "constants.h"
+#include "stringRegister.h"
+#include "itemSet.h"
+#include "taskScheduler.h"
 #include "geometry.h"
+#include "radixSort.h"
 #include "kd-tree.h"
 #include "geometricShape.h"
 #include "item.h"
+#include "incumbentScore.h"
 #include "packingContext.h"
 #include "binCalculationCache.h"
+#include "placementPolicy.h"
 #include "bin.h"
 #include "itemPositionConstructor.h"
 #include "packingCluster.h"
 #include "packer.h"
 #include "mixedBinPackerHandler.h"
+#include "feasibilityIndex.h"
+#include "binMixPlanner.h"
 #include "binComposer.h"
+#include "requestParser.h"
+#include "binaryProtocol.h"
 #include "outgoingJsonBuilder.h"
 #include "packingResultEvaluator.h"
 
+/**
+ * @brief Pack a validated binary request.
+ *
+ * @param aRequest
+ * @return std::shared_ptr<BinComposer>
+ */
+std::shared_ptr<BinComposer> packBinaryRequest(const BinaryRequestReader &aRequest)
+{
+    std::shared_ptr<ItemRegister> itemRegister =
+        std::make_shared<ItemRegister>(constants::itemRegister::parameter::sortMethod::OPTIMIZED,
+                                       aRequest.getNumberOfItems());
+
+    std::shared_ptr<BinComposer> binComposer = std::make_shared<BinComposer>(itemRegister, aRequest.getMinimizationStrategy(), aRequest.getMaxNrOfThreads(), aRequest.getMaxNrOfItemsPerShard());
+
+    aRequest.populate(binComposer);
+    binComposer->startPacking();
+    return binComposer;
+}
+
+/**
+ * @brief Pack a binary request and write the binary response.
+ *
+ * @param aResult
+ * @param aBufferSize
+ * @param aRequest
+ * @param aRequestSize
+ * @return int  - number of bytes written to aResult, or a negative constants::binary::status.
+ */
+int packBinaryRequest(char *aResult, const std::size_t aBufferSize, const char *aRequest, const std::size_t aRequestSize)
+{
+    BinaryRequestReader requestReader(aRequest, aRequestSize);
+    if (!requestReader.isValid())
+    {
+        return constants::binary::status::INVALID_REQUEST;
+    }
+
+    std::shared_ptr<BinComposer> binComposer = packBinaryRequest(requestReader);
+    return BinaryResponseWriter(binComposer, requestReader).write(aResult, aBufferSize);
+}
+
 /*
 Driver code.
 */
@@ -86,70 +171,37 @@ int main()
     const int responsePrecision = DEFAULT_RESPONSE_PRECISION;
     const int minimizationStrategy = DEFAULT_MINIMIZATION_STRATEGY;
 
-    std::ifstream incomingJsonFile(LOCAL_INPUT_FILE);
+    std::ifstream incomingFile(LOCAL_INPUT_FILE, std::ios::binary);
+    std::stringstream incomingStream;
+    incomingStream << incomingFile.rdbuf();
+    const std::string text = incomingStream.str();
 
-    std::string line, text;
-    while (std::getline(incomingJsonFile, line))
+    /* Binary requests get a binary response. */
+    if (BinaryRequestReader::isBinaryRequest(text.data(), text.size()))
     {
-        text += line + "\n";
+        std::vector<char> binaryResult(LOCAL_BINARY_RESULT_BUFFER_SIZE);
+        const int resultSize = packBinaryRequest(binaryResult.data(), binaryResult.size(), text.data(), text.size());
+
+        std::ofstream binaryFile(LOCAL_OUTPUT_FILE, std::ios::binary);
+        binaryFile.write(binaryResult.data(), std::max(resultSize, 0));
+        std::cout << resultSize << " bytes written, ";
+        std::cout << std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - start).count() << std::endl;
+        return 1;
     }
+
     const char *incomingJson = text.c_str();
 #endif
 
-        Json::Value inboundRoot;
-        std::stringstream(incomingJson) >> inboundRoot;
-
-        const Json::Value incomingJsonBins = inboundRoot[constants::json::inbound::bins::BINS];
-        const Json::Value incomingJsonItems = inboundRoot[constants::json::inbound::item::ITEMS];
+        RequestParser requestParser(incomingJson);
 
         std::shared_ptr<ItemRegister> itemRegister =
             std::make_shared<ItemRegister>(constants::itemRegister::parameter::sortMethod::OPTIMIZED,
-                                           incomingJsonItems.size());
+                                           requestParser.getNumberOfItems());
 
-        std::shared_ptr<BinComposer> binComposer = std::make_shared<BinComposer>(itemRegister, minimizationStrategy);
+        std::shared_ptr<BinComposer> binComposer = std::make_shared<BinComposer>(itemRegister, minimizationStrategy, requestParser.getMaxNrOfThreads(), requestParser.getMaxNrOfItemsPerShard());
 
-        for (int idx = incomingJsonBins.size(); idx--;)
-        {
-            std::shared_ptr<RequestedBin> requestedBin =
-                std::make_shared<RequestedBin>(incomingJsonBins[idx][constants::json::inbound::bins::TYPE].asString(),
-                                               incomingJsonBins[idx][constants::json::inbound::bins::WIDTH].asDouble() * MULTIPLIER,
-                                               incomingJsonBins[idx][constants::json::inbound::bins::DEPTH].asDouble() * MULTIPLIER,
-                                               incomingJsonBins[idx][constants::json::inbound::bins::HEIGHT].asDouble() * MULTIPLIER,
-                                               incomingJsonBins[idx][constants::json::inbound::bins::MAX_WEIGHT].asDouble(),
-                                               incomingJsonBins[idx][constants::json::inbound::bins::NR_OF_AVAILABLE_BINS].asInt(),
-                                               incomingJsonBins[idx][constants::json::inbound::bins::ITEM_LIMIT].asInt(),
-                                               incomingJsonBins[idx][constants::json::inbound::bins::PACKING_DIRECTION].asString(),
-                                               incomingJsonBins[idx][constants::json::inbound::bins::SORT_METHOD].asString(),
-                                               incomingJsonBins[idx][constants::json::inbound::bins::GRAVITY_STRENGTH].asDouble());
-
-            binComposer->addRequestedBin(requestedBin);
-        };
-
-        /* Initialize items and add them to the master register */
-        for (int idx = incomingJsonItems.size(); idx--;)
-        {
-
-            std::vector<std::string> compatibleBins = {};
-            for (int compatibleBinIdx = incomingJsonItems[idx][constants::json::item::COMPATIBLE_BINS].size(); compatibleBinIdx--;)
-            {
-                compatibleBins.push_back(incomingJsonItems[idx][constants::json::item::COMPATIBLE_BINS][compatibleBinIdx].asString());
-            };
-
-            binComposer->getMasterItemRegister()->addItem(
-                std::make_shared<Item>(idx + 1,
-                                       incomingJsonItems[idx][constants::json::item::ID].asString(),
-                                       incomingJsonItems[idx][constants::json::item::WIDTH].asDouble() * MULTIPLIER,
-                                       incomingJsonItems[idx][constants::json::item::DEPTH].asDouble() * MULTIPLIER,
-                                       incomingJsonItems[idx][constants::json::item::HEIGHT].asDouble() * MULTIPLIER,
-                                       incomingJsonItems[idx][constants::json::item::WEIGHT].asDouble(),
-                                       incomingJsonItems[idx][constants::json::item::ITEM_CONS_KEY].asString(),
-                                       incomingJsonItems[idx][constants::json::item::ALLOWED_ROTATIONS].asString(),
-                                       incomingJsonItems[idx][constants::json::item::GRAVITY_STRENGTH].asDouble(),
-                                       compatibleBins,
-                                       incomingJsonItems[idx][constants::json::item::STACKING_STYLE].asString()));
-
-            binComposer->addItem(idx + 1);
-        };
+        /* Initialize requested bins and items and add them to the bin composer. */
+        requestParser.populate(binComposer);
 
         binComposer->startPacking();
 
@@ -169,6 +221,61 @@ int main()
             return 0;
         }
     };
+
+    /**
+     * @brief Binary variant of packToMixedBinsAlgorithm, see binaryProtocol.md for the layout.
+     *
+     * @return int  - number of bytes written to result, or a negative constants::binary::status.
+     */
+    int packToMixedBinsAlgorithmBinary(char *result,
+                                       const int bufferSize,
+                                       const char *request,
+                                       const int requestSize)
+    {
+        return packBinaryRequest(result, std::max(bufferSize, 0), request, std::max(requestSize, 0));
+    };
+
+    /**
+     * @brief Struct array variant of packToMixedBinsAlgorithm, records are the binary protocol records.
+     *
+     * String fields of the records are indices in strings. The result header is always filled,
+     * when one of the result arrays is too small it reports the required number of records.
+     *
+     * @return int  - 0, or a negative constants::binary::status.
+     */
+    int packToMixedBinsAlgorithmStructs(const BinaryBinRecord *bins,
+                                        const int nrOfBins,
+                                        const BinaryItemRecord *items,
+                                        const int nrOfItems,
+                                        const uint32_t *compatibleBinRefs,
+                                        const int nrOfCompatibleBinRefs,
+                                        const char *const *strings,
+                                        const int nrOfStrings,
+                                        const int minimizationStrategy,
+                                        BinaryResponseHeader *resultHeader,
+                                        BinaryBinSummary *binSummaries,
+                                        const int binSummaryCapacity,
+                                        BinaryPlacement *placements,
+                                        const int placementCapacity,
+                                        uint32_t *unfittedItems,
+                                        const int unfittedItemCapacity)
+    {
+        BinaryRequestReader requestReader(bins, std::max(nrOfBins, 0),
+                                          items, std::max(nrOfItems, 0),
+                                          compatibleBinRefs, std::max(nrOfCompatibleBinRefs, 0),
+                                          strings, std::max(nrOfStrings, 0),
+                                          minimizationStrategy);
+        if (!requestReader.isValid() || !resultHeader)
+        {
+            return constants::binary::status::INVALID_REQUEST;
+        }
+
+        std::shared_ptr<BinComposer> binComposer = packBinaryRequest(requestReader);
+        return BinaryResponseWriter(binComposer, requestReader).write(resultHeader,
+                                                                      binSummaries, std::max(binSummaryCapacity, 0),
+                                                                      placements, std::max(placementCapacity, 0),
+                                                                      unfittedItems, std::max(unfittedItemCapacity, 0));
+    };
 };
 #else
     std::ofstream myfile;
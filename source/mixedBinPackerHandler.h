@@ -26,27 +26,12 @@ public:
     /**
      * @brief Remove itemKeys from the global items to be packed by iterating over the packed items of the packed bin which has been added last.
      *
+     * The items to be removed are put in an ItemSet, so this is linear in the number of items.
+     *
      */
-    std::vector<int> removeDuplicateIntegers(std::vector<int> aFilteredItems, std::vector<int> aItemsToBeRemoved)
+    std::vector<int> removeDuplicateIntegers(std::vector<int> aFilteredItems, const std::vector<int> &aItemsToBeRemoved)
     {
-        aFilteredItems.erase(
-            std::remove_if(begin(aFilteredItems),
-                           end(aFilteredItems),
-                           [&](int &itemToBePackedKey) -> bool
-                           {
-                               bool isDuplicate = false;
-                               for (const int packedItem : aItemsToBeRemoved)
-                               {
-                                   if (packedItem == itemToBePackedKey)
-                                   {
-                                       isDuplicate = true;
-                                       break;
-                                   };
-                               };
-                               return isDuplicate;
-                           }),
-            end(aFilteredItems));
-
+        ItemSet(aItemsToBeRemoved).removeFrom(aFilteredItems);
         return aFilteredItems;
     }
 };
@@ -52,15 +52,15 @@ private:
         };
 
         // Stacking style.
-        if (item->Item::stackingStyle_ == constants::item::parameter::ALLOW_ALL)
+        if (item->Item::stackingStyle_ == constants::item::stackingStyle::ALLOW_ALL)
         {
             JsonItem[constants::json::item::STACKING_STYLE] = constants::json::item::stackingStyle::ALLOW_ALL;
         }
-        else if (item->Item::stackingStyle_ == constants::item::parameter::NO_ITEMS_ON_TOP)
+        else if (item->Item::stackingStyle_ == constants::item::stackingStyle::NO_ITEMS_ON_TOP)
         {
             JsonItem[constants::json::item::STACKING_STYLE] = constants::json::item::stackingStyle::NO_ITEMS_ON_TOP;
         }
-        else if (item->Item::stackingStyle_ == constants::item::parameter::BOTTOM_NO_ITEMS_ON_TOP)
+        else if (item->Item::stackingStyle_ == constants::item::stackingStyle::BOTTOM_NO_ITEMS_ON_TOP)
         {
             JsonItem[constants::json::item::STACKING_STYLE] = constants::json::item::stackingStyle::BOTTOM_NO_ITEMS_ON_TOP;
         }
@@ -161,10 +161,10 @@ public:
             /* If includeItems parameter is false, skip generating json for the items. */
             if (ResponseBuilder::includeItems_)
             {
-                for (const auto &item : bin->Bin::getFittedItems())
+                for (const std::shared_ptr<Item> &item : bin->Bin::getPackedItems())
                 {
                     mappedBin[constants::json::outbound::bin::FITTED_ITEMS].append(
-                        ResponseBuilder::itemToJson(bin->getContext()->getItem(item)));
+                        ResponseBuilder::itemToJson(item));
                 };
             };
 
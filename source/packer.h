@@ -6,9 +6,11 @@ class Packer
 private:
     std::shared_ptr<PackingContext> context_;
     std::vector<std::shared_ptr<PackingCluster>> clusters_;
+    int nrOfExcludedItems_;
 
 public:
-    Packer(std::shared_ptr<PackingContext> aContext) : context_(aContext){};
+    Packer(std::shared_ptr<PackingContext> aContext) : context_(aContext),
+                                                       nrOfExcludedItems_(0){};
 
     /**
      * @brief Get context.
@@ -58,6 +60,27 @@ public:
      */
     const bool hasUnfittedItems() { return Packer::getNumberOfUnfittedItems() > 0; };
 
+    /**
+     * @brief Returns a bool indicating if packing stopped because the incumbent score could not be beaten.
+     *
+     * @return const bool
+     */
+    const bool isCancelled() const { return !Packer::clusters_.empty() && Packer::clusters_.back()->isCancelled(); };
+
+    /**
+     * @brief Set the number of items left out of this packer because they are not compatible with its bin or never fit in it.
+     *
+     * @param aNrOfExcludedItems
+     */
+    void setNumberOfExcludedItems(const int aNrOfExcludedItems) { Packer::nrOfExcludedItems_ = aNrOfExcludedItems; };
+
+    /**
+     * @brief Returns a bool indicating if items were left out of this packer because they are not compatible with its bin or never fit in it.
+     *
+     * @return const bool
+     */
+    const bool hasExcludedItems() const { return Packer::nrOfExcludedItems_ > 0; };
+
     /**
      * @brief Get the total number of bins required.
      *
@@ -86,7 +109,7 @@ public:
      */
     void startPackingCluster(std::vector<int> aItemsToBePacked)
     {
-        if (aItemsToBePacked.empty())
+        if (aItemsToBePacked.empty() || Packer::isCancelled())
         {
             return;
         };
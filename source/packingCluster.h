@@ -8,7 +8,11 @@ private:
     std::shared_ptr<PackingContext> context_;
     int binIdCounter_;
     std::vector<int> unfittedItems_;
+    std::vector<std::shared_ptr<Bin>> fullestClosedBins_;
+    double fullestClosedBinUtil_;
     bool optimizedPackingCompatible_;
+    bool cancelled_;
+    PlacementKernel placementKernel_;
 
     void decrementBinCounter() { PackingCluster::binIdCounter_ -= 1; };
     void incrementBinCounter() { PackingCluster::binIdCounter_ += 1; };
@@ -19,7 +23,36 @@ private:
      * @return true
      * @return false
      */
-    const bool compliesWithNrOfAvailableBins() const { return !PackingCluster::context_->getRequestedBin()->exceedsNrOfAvailableBins(PackingCluster::binIdCounter_); }
+    const bool compliesWithNrOfAvailableBins() const { return !PackingCluster::context_->exceedsNrOfBins(PackingCluster::binIdCounter_); }
+
+    /**
+     * @brief Called once no more items will be placed in the bin, frees its search structures if it can not be the winning bin.
+     *
+     * The winning bin of a packer is one of its fullest bins and is packed further, so the fullest closed bins keep their
+     * search structures until a fuller bin is closed. Bins with equal fill are all kept, the winner is picked among them later.
+     *
+     * @param aBin
+     */
+    void closeBin(const std::shared_ptr<Bin> &aBin)
+    {
+        const double binUtil = aBin->getRealActualVolumeUtilPercentage();
+        if (binUtil < PackingCluster::fullestClosedBinUtil_)
+        {
+            aBin->releaseSearchStructures();
+            return;
+        };
+
+        if (binUtil > PackingCluster::fullestClosedBinUtil_)
+        {
+            for (const std::shared_ptr<Bin> &fullestClosedBin : PackingCluster::fullestClosedBins_)
+            {
+                fullestClosedBin->releaseSearchStructures();
+            };
+            PackingCluster::fullestClosedBins_.clear();
+            PackingCluster::fullestClosedBinUtil_ = binUtil;
+        };
+        PackingCluster::fullestClosedBins_.push_back(aBin);
+    }
 
     /**
      * @brief Called once packing for the cluster is finished.
@@ -55,6 +88,7 @@ private:
 
             int heightToIncrement = 0;
             std::vector<int> relevantItems = positionConstructor->getRelevantItems();
+            std::vector<int> packedItems = {};
 
             const int nrOfRelevantItems = (int)relevantItems.size();
             const int startingIndexCorrection = std::max(0, (nrOfRelevantItems - positionConstructor->getNumberOfBaseItems()));
@@ -88,8 +122,8 @@ private:
 
                 if (fits)
                 {
-                    PackingCluster::getLastCreatedBin()->addFittedItem(myItem->transientSysId_, 99);
-                    aItemsToBePacked.erase(std::remove(aItemsToBePacked.begin(), aItemsToBePacked.end(), myItem->transientSysId_), aItemsToBePacked.end());
+                    PackingCluster::getLastCreatedBin()->addFittedItem(myItem->transientSysId_);
+                    packedItems.push_back(myItem->transientSysId_);
                     heightToIncrement = myItem->height_;
                 }
                 else
@@ -99,11 +133,13 @@ private:
                 }
             };
 
+            ItemSet(packedItems).removeFrom(aItemsToBePacked);
+
             // Layer has been build, now add the height of the layer and decide if we should attempt to build a second layer.
             positionConstructor->addToHeightAddition(heightToIncrement);
             if (continueLayingLayers)
             {
-                positionConstructor->reconfigure(aItemsToBePacked);
+                positionConstructor->removePackedItems(packedItems);
                 // std::cout << "has bin:" << positionConstructor->hasPrecalculatedBinAvailable() << "\n";
             }
         };
@@ -111,6 +147,296 @@ private:
         return aItemsToBePacked;
     };
 
+    /**
+     * @brief Place the items to be packed one by one in the bin, items which do not fit are added to its unfitted items.
+     *
+     * Only touches the bin and the items to be packed, so bins filled with different items can be filled at the same time.
+     *
+     * @param aBin
+     * @param aItemsToBePacked
+     */
+    void fillBin(const std::shared_ptr<Bin> &aBin, const std::vector<int> &aItemsToBePacked) const
+    {
+        std::vector<double> minWeights;
+        std::vector<double> minVolumes;
+        PackingCluster::getRemainingMinima(aItemsToBePacked, minWeights, minVolumes);
+
+        int nrOfFittedItems = -1;
+        for (int idx = 0; idx < (int)aItemsToBePacked.size(); idx++)
+        {
+            const int itemToPackKey = aItemsToBePacked[idx];
+
+            /*  The bin can not take the smallest item left, the items left go straight to the next bin.
+                This can only change once an item got placed or the smallest item left got bigger. */
+            const bool binChanged = nrOfFittedItems != (int)aBin->getFittedItems().size();
+            if ((binChanged || minWeights[idx] != minWeights[idx - 1] || minVolumes[idx] != minVolumes[idx - 1]) &&
+                aBin->isFullFor(minWeights[idx], minVolumes[idx]))
+            {
+                for (; idx < (int)aItemsToBePacked.size(); idx++)
+                {
+                    aBin->addUnfittedItem(aItemsToBePacked[idx]);
+                };
+                break;
+            };
+            nrOfFittedItems = (int)aBin->getFittedItems().size();
+
+            // An item of the same item type was rejected and nothing changed that could let this one in.
+            if (aBin->isRejected(itemToPackKey))
+            {
+                aBin->addUnfittedItem(itemToPackKey);
+            }
+            else if (aBin->wouldExceedLimit(itemToPackKey))
+            {
+                aBin->rememberRejectedItem(itemToPackKey);
+                aBin->addUnfittedItem(itemToPackKey);
+            }
+            // checks for unfitted items which are the same as current item.
+            else if (!aBin->getUnfittedItems().empty() &&
+                     PackingCluster::context_->getItemRegister()->itemsAreEqual(itemToPackKey, aBin->Bin::getUnfittedItems().back()))
+            {
+                aBin->addUnfittedItem(itemToPackKey);
+            }
+            else if (aBin->getFittedItems().empty())
+            {
+                aBin->placeItem(itemToPackKey) ? aBin->addFittedItem(itemToPackKey) : aBin->addUnfittedItem(itemToPackKey);
+            }
+            else
+            {
+                aBin->searchPositionAndPlaceItem(itemToPackKey);
+            }
+        };
+    };
+
+    /**
+     * @brief Predict the items of the bins to be packed at the same time after the last bin, an empty result means packing one by one.
+     *
+     * Every bin gets the next items in packing order, until it would hold more volume than the last bin got
+     * or the weight or item limit would be exceeded. The number of bins stays within the available bins and the
+     * number of bins with which the incumbent score can still be beaten.
+     *
+     * @param aItemsToBePacked
+     * @return const std::vector<std::vector<int>>
+     */
+    const std::vector<std::vector<int>> predictBinSubsets(const std::vector<int> &aItemsToBePacked) const
+    {
+        std::vector<std::vector<int>> binSubsets;
+        const std::shared_ptr<RequestedBin> &requestedBin = PackingCluster::context_->getRequestedBin();
+        const double volumeCapacity = PackingCluster::getLastCreatedBin()->getRealActualVolumeUtil();
+
+        int nrOfBins = requestedBin->getNrOfSpeculativeBins();
+        while (nrOfBins > 0 &&
+               (PackingCluster::context_->exceedsNrOfBins(PackingCluster::binIdCounter_ + nrOfBins) ||
+                PackingCluster::context_->isOutscored(PackingCluster::binIdCounter_ + nrOfBins)))
+        {
+            nrOfBins--;
+        };
+
+        if (nrOfBins < 2 || volumeCapacity <= 0)
+        {
+            return binSubsets;
+        };
+
+        double volume = 0;
+        double weight = 0;
+        for (const int itemKey : aItemsToBePacked)
+        {
+            const std::shared_ptr<Item> &item = PackingCluster::context_->peekItem(itemKey);
+            if (binSubsets.empty() ||
+                volume + item->Item::volume_ > volumeCapacity ||
+                weight + item->Item::weight_ > requestedBin->getMaxWeight() ||
+                requestedBin->exceedsItemLimit((int)binSubsets.back().size() + 1))
+            {
+                if ((int)binSubsets.size() == nrOfBins)
+                {
+                    break;
+                };
+                binSubsets.emplace_back();
+                volume = 0;
+                weight = 0;
+            };
+
+            binSubsets.back().push_back(itemKey);
+            volume += item->Item::volume_;
+            weight += item->Item::weight_;
+        };
+
+        if (binSubsets.size() < 2)
+        {
+            binSubsets.clear();
+        };
+        return binSubsets;
+    }
+
+    /**
+     * @brief Pack the next bins at the same time, every bin with its predicted items, then continue with the items left.
+     *
+     * A bin whose predicted items did not all fit was mispredicted. Its items left are tried in the other new bins,
+     * in bin order, before they go to the bins after. Bins only touch their own items, so the result does not depend
+     * on the number of threads.
+     *
+     * @param aBinSubsets
+     * @param aItemsToBePacked
+     */
+    void speculativePacking(const std::vector<std::vector<int>> &aBinSubsets, const std::vector<int> &aItemsToBePacked)
+    {
+        const int firstBinIndex = (int)PackingCluster::bins_.size();
+        for (const std::vector<int> &binSubset : aBinSubsets)
+        {
+            PackingCluster::addBin((int)binSubset.size());
+        };
+
+        auto packBin = [&](const int aBinIndex)
+        {
+            PackingCluster::fillBin(PackingCluster::bins_[firstBinIndex + aBinIndex], aBinSubsets[aBinIndex]);
+        };
+        TaskScheduler::parallelFor((int)aBinSubsets.size(), PackingCluster::context_->getThreadBudget(), packBin);
+
+        ItemSet mispredictedItemSet;
+        for (int idx = firstBinIndex; idx < (int)PackingCluster::bins_.size(); idx++)
+        {
+            mispredictedItemSet.insert(PackingCluster::bins_[idx]->getUnfittedItems());
+            PackingCluster::bins_[idx]->clearUnfittedItems();
+        };
+
+        std::vector<int> mispredictedItems;
+        for (const int itemKey : aItemsToBePacked)
+        {
+            if (mispredictedItemSet.contains(itemKey))
+            {
+                mispredictedItems.push_back(itemKey);
+            };
+        };
+
+        ItemSet fittedItems;
+        for (int idx = firstBinIndex; idx < (int)PackingCluster::bins_.size(); idx++)
+        {
+            if (!mispredictedItems.empty() && !PackingCluster::bins_[idx]->getFittedItems().empty())
+            {
+                PackingCluster::bins_[idx]->addItems(mispredictedItems);
+                ItemSet(PackingCluster::bins_[idx]->getFittedItems()).removeFrom(mispredictedItems);
+            };
+            fittedItems.insert(PackingCluster::bins_[idx]->getFittedItems());
+        };
+
+        // Bins in which no item fitted are dropped, the bin ids stay consecutive.
+        for (int idx = (int)PackingCluster::bins_.size(); idx-- > firstBinIndex;)
+        {
+            if (PackingCluster::bins_[idx]->getFittedItems().empty())
+            {
+                PackingCluster::bins_.erase(PackingCluster::bins_.begin() + idx);
+                PackingCluster::decrementBinCounter();
+            };
+        };
+        for (int idx = firstBinIndex; idx < (int)PackingCluster::bins_.size(); idx++)
+        {
+            PackingCluster::bins_[idx]->id_ = idx + 1;
+        };
+
+        // The items left become the unfitted items of the last bin, as if the bins had been packed one by one.
+        std::vector<int> itemsLeft = aItemsToBePacked;
+        fittedItems.removeFrom(itemsLeft);
+        PackingCluster::getLastCreatedBin()->clearUnfittedItems();
+        for (const int itemKey : itemsLeft)
+        {
+            PackingCluster::getLastCreatedBin()->addUnfittedItem(itemKey);
+        };
+
+        for (int idx = firstBinIndex; idx < (int)PackingCluster::bins_.size(); idx++)
+        {
+            PackingCluster::closeBin(PackingCluster::bins_[idx]);
+        };
+        PackingCluster::startPackingBins(PackingCluster::getLastCreatedBin()->Bin::getUnfittedItems());
+    }
+
+    /**
+     * @brief Checks if the last bin is to be split into zones, the bin asks for zones and every zone gets enough items.
+     *
+     * An item limit below the number of zones leaves a zone a share of 0, which would mean no limit at all.
+     *
+     * @param aItemsToBePacked
+     * @return true
+     * @return false
+     */
+    const bool usesZones(const std::vector<int> &aItemsToBePacked) const
+    {
+        const int nrOfZones = PackingCluster::context_->getRequestedBin()->getNrOfZones();
+        const int itemLimit = PackingCluster::context_->getRequestedBin()->getItemLimit();
+        return nrOfZones > 1 &&
+               (itemLimit == 0 || itemLimit >= nrOfZones) &&
+               PackingCluster::context_->getRequestedBin()->getDepth() >= nrOfZones &&
+               (int)aItemsToBePacked.size() >= nrOfZones * constants::bin::zone::MIN_NR_OF_ITEMS;
+    }
+
+    /**
+     * @brief Split the last bin into zones along its depth and pack the zones at the same time, return the items left to be packed.
+     *
+     * Items are dealt in packing order to the zone with the least volume so far. Every zone is packed as a bin of its own,
+     * then the zones are added to the last bin side by side. The items left are packed around them afterwards, which also
+     * fills the gaps at the zone borders.
+     *
+     * @param aItemsToBePacked
+     * @return std::vector<int>&
+     */
+    std::vector<int> &zonedPacking(std::vector<int> &aItemsToBePacked)
+    {
+        const std::shared_ptr<RequestedBin> &requestedBin = PackingCluster::context_->getRequestedBin();
+        const int nrOfZones = requestedBin->getNrOfZones();
+        const int zoneDepth = requestedBin->getDepth() / nrOfZones;
+        const std::shared_ptr<PackingContext> zoneContext = std::make_shared<PackingContext>(PackingCluster::context_->getGravity(),
+                                                                                             PackingCluster::context_->getItemRegister(),
+                                                                                             requestedBin->getZone(zoneDepth));
+
+        std::vector<std::vector<int>> zoneItems(nrOfZones);
+        std::vector<double> zoneVolumes(nrOfZones, 0.0);
+        for (const int itemKey : aItemsToBePacked)
+        {
+            const int zone = (int)(std::min_element(zoneVolumes.begin(), zoneVolumes.end()) - zoneVolumes.begin());
+            const double itemVolume = PackingCluster::context_->peekItem(itemKey)->Item::volume_;
+            if (zoneVolumes[zone] + itemVolume > zoneContext->getRequestedBin()->getMaxVolume())
+            {
+                continue;
+            };
+            zoneItems[zone].push_back(itemKey);
+            zoneVolumes[zone] += itemVolume;
+        };
+
+        // Zones only touch their own items, items which do not fit are reset and left for the last bin.
+        std::vector<std::shared_ptr<Bin>> zoneBins(nrOfZones);
+        auto packZone = [&](const int aZone)
+        {
+            std::shared_ptr<Bin> zoneBin = std::make_shared<Bin>(aZone, zoneContext, (int)zoneItems[aZone].size());
+            zoneBin->setPlacementKernel(PackingCluster::placementKernel_);
+            for (const int itemKey : zoneItems[aZone])
+            {
+                if (zoneBin->isRejected(itemKey))
+                {
+                    continue;
+                };
+
+                if (zoneBin->getFittedItems().empty() && !zoneBin->wouldExceedLimit(itemKey) && zoneBin->placeItem(itemKey))
+                {
+                    zoneBin->addFittedItem(itemKey);
+                }
+                else if (zoneBin->getFittedItems().empty() || zoneBin->wouldExceedLimit(itemKey) || !zoneBin->searchPosition(itemKey))
+                {
+                    zoneBin->rememberRejectedItem(itemKey);
+                    zoneContext->getItemRegister()->resetItem(itemKey);
+                };
+            };
+            zoneBins[aZone] = zoneBin;
+        };
+        TaskScheduler::parallelFor(nrOfZones, PackingCluster::context_->getThreadBudget(), packZone);
+
+        ItemSet zonedItems;
+        for (int zone = 0; zone < nrOfZones; zone++)
+        {
+            zonedItems.insert(PackingCluster::getLastCreatedBin()->addZoneItems(*zoneBins[zone], zone * zoneDepth));
+        };
+        zonedItems.removeFrom(aItemsToBePacked);
+
+        return aItemsToBePacked;
+    };
+
     /**
      * @brief Sets the flag indicating if the packing cluster can use optimized packing order.
      *
@@ -124,6 +450,18 @@ private:
              PackingCluster::context_->getRequestedBin()->getPackingDirection() == constants::bin::parameter::BOTTOM_UP_ARRAY);
     }
 
+    /**
+     * @brief Pick the placement kernel for the bins of the cluster, it leaves out the gravity and stacking style checks the items do not need.
+     *
+     * @param aItemsToBePacked
+     */
+    void selectPlacementKernel(const std::vector<int> &aItemsToBePacked)
+    {
+        PackingCluster::placementKernel_ = Bin::selectPlacementKernel(PackingCluster::context_->getRequestedBin()->getPackingDirection(),
+                                                                      PackingCluster::context_->getGravity()->gravityEnabledForAny(aItemsToBePacked),
+                                                                      PackingCluster::context_->getItemRegister()->containsItemWithStackingStyle(aItemsToBePacked));
+    }
+
     /**
      * @brief Place item on its current position inside the bin.
      *
@@ -141,7 +479,7 @@ private:
         if (aCommit)
         {
             itemFits
-                ? PackingCluster::bins_.back()->Bin::addFittedItem(aItemKey, 99)
+                ? PackingCluster::bins_.back()->Bin::addFittedItem(aItemKey)
                 : PackingCluster::getLastCreatedBin()->addUnfittedItem(aItemKey);
         }
 
@@ -149,79 +487,103 @@ private:
     }
 
     /**
-     * @brief Checks if adding the item would exceed the bins limits.
-     *  Seperate function because this might be extended later by custom non-physical limits.
-     *
-     * @param aItemKey
-     * @return true
-     * @return false
-     */
-    const bool wouldExceedLimit(const int aItemKey) const
-    {
-        return PackingCluster::wouldExceedPhysicalLimit(aItemKey) || PackingCluster::wouldExceedArtificialItemLimit(1);
-    };
-
-    /**
-     * @brief Checks if two double should be considered as being equal.
+     * @brief Fill the last bin with a copy of the bin before it, if the items to be packed hold another copy of its items.
      *
-     * @param double1
-     * @param double2
-     * @return true
-     * @return false
-     */
-    const bool doublesAreLooselyEqual(const double double1, const double double2) const
-    {
-        const double relative_difference_factor = 0.0001; // 0.01%
-        const double greater_magnitude = std::max(std::abs(double1), std::abs(double2));
-        return (std::abs(double1 - double2) < relative_difference_factor * greater_magnitude);
-    }
-
-    /**
-     * @brief Checks if adding the item would exceed the bins physical limits.
+     * Every item of the previous bin is replaced by the first item to be packed of the same item type, which gets the
+     * same rotation and position. Items of one item type agree in everything the placement checks, gravity strength
+     * included, so the copy fits and keeps its support without searching.
      *
-     * @param aItemKey
+     * @param aItemsToBePacked
      * @return true
      * @return false
      */
-    const bool wouldExceedPhysicalLimit(const int aItemKey) const
+    const bool replicatePreviousBin(const std::vector<int> &aItemsToBePacked)
     {
-        const bool exceedsLimit = true;
+        if (PackingCluster::bins_.size() < 2)
+        {
+            return false;
+        };
 
-        const double newBinWeight = PackingCluster::getLastCreatedBin()->getRealActualWeightUtil() + PackingCluster::context_->getItem(aItemKey)->Item::weight_;
-        const double newBinVolume = PackingCluster::getLastCreatedBin()->getRealActualVolumeUtil() + PackingCluster::context_->getItem(aItemKey)->Item::volume_;
+        const std::shared_ptr<Bin> &previousBin = PackingCluster::bins_[PackingCluster::bins_.size() - 2];
+        if (previousBin->getFittedItems().size() > aItemsToBePacked.size())
+        {
+            return false;
+        };
 
-        if (!PackingCluster::doublesAreLooselyEqual(newBinWeight, context_->getRequestedBin()->getMaxWeight()))
+        std::unordered_map<int, int> nrOfItemsNeeded;
+        for (const int placedItemKey : previousBin->getFittedItems())
         {
-            if (newBinWeight > context_->getRequestedBin()->getMaxWeight())
+            const int itemTypeId = PackingCluster::context_->peekItem(placedItemKey)->itemTypeId_;
+            if (itemTypeId < 0)
             {
-                return exceedsLimit;
+                return false;
             };
-        }
+            nrOfItemsNeeded[itemTypeId]++;
+        };
 
-        if (!PackingCluster::doublesAreLooselyEqual(newBinVolume, context_->getRequestedBin()->getMaxVolume()))
+        int nrOfItemsFound = 0;
+        std::unordered_map<int, std::vector<int>> itemsPerItemType;
+        for (const int itemKey : aItemsToBePacked)
         {
-            if (newBinVolume > context_->getRequestedBin()->getMaxVolume())
+            const int itemTypeId = PackingCluster::context_->peekItem(itemKey)->itemTypeId_;
+            const std::unordered_map<int, int>::iterator itemsNeeded = nrOfItemsNeeded.find(itemTypeId);
+            if (itemsNeeded != nrOfItemsNeeded.end() && itemsNeeded->second > 0)
             {
-                return exceedsLimit;
+                itemsNeeded->second--;
+                itemsPerItemType[itemTypeId].push_back(itemKey);
+                nrOfItemsFound++;
             };
         };
 
-        return !exceedsLimit;
+        if (nrOfItemsFound < (int)previousBin->getFittedItems().size())
+        {
+            return false;
+        };
+
+        std::unordered_map<int, int> nrOfItemsPlaced;
+        for (const int placedItemKey : previousBin->getFittedItems())
+        {
+            const int itemTypeId = PackingCluster::context_->peekItem(placedItemKey)->itemTypeId_;
+            const int itemKey = itemsPerItemType[itemTypeId][nrOfItemsPlaced[itemTypeId]++];
+            PackingCluster::getLastCreatedBin()->placeItemAs(itemKey, placedItemKey);
+        };
+
+        return true;
     }
 
     /**
-     * @brief Checks if the packer confirms to the max items per bin limit enforces by the user.
+     * @brief Checks if adding the item would exceed the limits of the last bin.
      *
+     * @param aItemKey
      * @return true
      * @return false
      */
-    const bool wouldExceedArtificialItemLimit(const int aItemAddition) const
+    const bool wouldExceedLimit(const int aItemKey) const
     {
-
-        const int newNrOfItemsInBin = aItemAddition + ((int)PackingCluster::getLastCreatedBin()->getFittedItems().size());
-        return PackingCluster::context_->getRequestedBin()->exceedsItemLimit(newNrOfItemsInBin);
+        return PackingCluster::getLastCreatedBin()->wouldExceedLimit(aItemKey);
     };
 
+    /**
+     * @brief Get the smallest weight and volume of the items from every index onwards.
+     *
+     * The entry after the last item holds the largest double, so an empty remainder never closes a bin.
+     *
+     * @param aItemsToBePacked  - vector containing itemKeys
+     * @param aMinWeights
+     * @param aMinVolumes
+     */
+    void getRemainingMinima(const std::vector<int> &aItemsToBePacked, std::vector<double> &aMinWeights, std::vector<double> &aMinVolumes) const
+    {
+        aMinWeights.assign(aItemsToBePacked.size() + 1, std::numeric_limits<double>::max());
+        aMinVolumes.assign(aItemsToBePacked.size() + 1, std::numeric_limits<double>::max());
+        for (int idx = (int)aItemsToBePacked.size(); idx--;)
+        {
+            const std::shared_ptr<Item> &item = PackingCluster::context_->peekItem(aItemsToBePacked[idx]);
+            aMinWeights[idx] = std::min(aMinWeights[idx + 1], item->Item::weight_);
+            aMinVolumes[idx] = std::min(aMinVolumes[idx + 1], item->Item::volume_);
+        };
+    }
+
     /**
      * @brief Return an integer representing the estimated number of items that will fit a empty bin.
      *
@@ -238,7 +600,7 @@ private:
 
         for (auto itemKey : aItemsToBePacked)
         {
-            const std::shared_ptr<Item> itemToCheck = PackingCluster::context_->getItem(itemKey);
+            const std::shared_ptr<Item> &itemToCheck = PackingCluster::context_->peekItem(itemKey);
 
             if ((itemToCheck->volume_ + volumeCumulativeValue) < PackingCluster::context_->getRequestedBin()->getMaxVolume())
             {
@@ -265,6 +627,7 @@ private:
     {
         PackingCluster::incrementBinCounter();
         PackingCluster::bins_.push_back(std::make_shared<Bin>(PackingCluster::binIdCounter_, PackingCluster::context_, aEstimatedNumberOfItemsToFit));
+        PackingCluster::bins_.back()->setPlacementKernel(PackingCluster::placementKernel_);
     }
 
     /**
@@ -311,6 +674,17 @@ private:
             return;
         };
 
+        /*
+            Packing stops once the bin to be created can no longer beat the incumbent score.
+            An empty new bin would leave items unfitted, so with it this packer would need at least as many bins.
+            The items left are added to the unfitted items so none get lost. */
+        if (PackingCluster::context_->isOutscored(PackingCluster::binIdCounter_ + 1))
+        {
+            PackingCluster::cancelled_ = true;
+            PackingCluster::addUnfittedItems(aItemsToBePacked);
+            return;
+        };
+
         /* Create a new bin. */
         PackingCluster::addBin(PackingCluster::estimatedNumberOfItemsToFit(aItemsToBePacked));
 
@@ -325,39 +699,39 @@ private:
             return;
         }
 
+        /* The items to be packed hold another copy of the previous bin, copy it instead of searching. */
+        if (PackingCluster::replicatePreviousBin(aItemsToBePacked))
+        {
+            const ItemSet replicatedItems(PackingCluster::getLastCreatedBin()->getFittedItems());
+            for (const int itemKey : aItemsToBePacked)
+            {
+                if (!replicatedItems.contains(itemKey))
+                {
+                    PackingCluster::getLastCreatedBin()->addUnfittedItem(itemKey);
+                };
+            };
+
+            PackingCluster::closeBin(PackingCluster::getLastCreatedBin());
+            PackingCluster::startPackingBins(PackingCluster::getLastCreatedBin()->Bin::getUnfittedItems());
+            return;
+        };
+
         /**
          * Start packing evaluation process.
          *
-         * First check if optimized layer packing is to be used.
+         * First check if the bin is split into zones, else if optimized layer packing is to be used.
          * Then, perform iterative item position searching method on the left-over items.
          */
-        if (PackingCluster::optimizedPackingCompatible_)
+        if (PackingCluster::usesZones(aItemsToBePacked))
+        {
+            aItemsToBePacked = PackingCluster::zonedPacking(aItemsToBePacked);
+        }
+        else if (PackingCluster::optimizedPackingCompatible_)
         {
             aItemsToBePacked = PackingCluster::optimizedLayerPacking(aItemsToBePacked);
         };
 
-        for (const int itemToPackKey : aItemsToBePacked)
-        {
-
-            if (PackingCluster::wouldExceedLimit(itemToPackKey))
-            {
-                PackingCluster::getLastCreatedBin()->addUnfittedItem(itemToPackKey);
-            }
-            // checks for unfitted items which are the same as current item.
-            else if (!PackingCluster::getLastCreatedBin()->getUnfittedItems().empty() &&
-                     PackingCluster::context_->getItemRegister()->itemsAreEqual(itemToPackKey, PackingCluster::getLastCreatedBin()->Bin::getUnfittedItems().back()))
-            {
-                PackingCluster::getLastCreatedBin()->addUnfittedItem(itemToPackKey);
-            }
-            else if (PackingCluster::getLastCreatedBin()->getFittedItems().empty())
-            {
-                PackingCluster::placeItem(itemToPackKey);
-            }
-            else
-            {
-                PackingCluster::getLastCreatedBin()->searchPositionAndPlaceItem(itemToPackKey);
-            }
-        };
+        PackingCluster::fillBin(PackingCluster::getLastCreatedBin(), aItemsToBePacked);
 
         /*  No items could be packed, so we can close the cluster.
         First call closeCluster, this way we copy the unfitted items to the cluster.
@@ -369,15 +743,199 @@ private:
             return;
         }
 
-        /*  Bin has been packed. Recurse with the unfitted items of the previous bin. */
+        /*  Bin has been packed. Recurse with the unfitted items of the previous bin, or first pack the next bins at the same time. */
+        PackingCluster::closeBin(PackingCluster::getLastCreatedBin());
+        const std::vector<std::vector<int>> binSubsets = PackingCluster::predictBinSubsets(PackingCluster::getLastCreatedBin()->Bin::getUnfittedItems());
+        if (!binSubsets.empty())
+        {
+            PackingCluster::speculativePacking(binSubsets, PackingCluster::getLastCreatedBin()->Bin::getUnfittedItems());
+            return;
+        };
         PackingCluster::startPackingBins(PackingCluster::getLastCreatedBin()->Bin::getUnfittedItems());
     };
 
+    /**
+     * @brief Try to place an item in one of the open bins, in the order of the open bin policy.
+     *
+     * First fit tries the open bins oldest first, best fit tries the fullest bin first.
+     * A bin is skipped if the item would exceed its limits or the bin still rejects items of its item type.
+     *
+     * @param aOpenBins
+     * @param aItemKey
+     * @return true
+     * @return false
+     */
+    const bool placeInOpenBin(const std::vector<std::shared_ptr<Bin>> &aOpenBins, const int aItemKey)
+    {
+        std::vector<int> binOrder(aOpenBins.size());
+        std::iota(binOrder.begin(), binOrder.end(), 0);
+        if (PackingCluster::context_->getRequestedBin()->getOpenBinPolicy() == constants::bin::parameter::openBinPolicy::BEST_FIT)
+        {
+            std::stable_sort(binOrder.begin(), binOrder.end(), [&aOpenBins](const int binLeft, const int binRight)
+                             { return aOpenBins[binLeft]->getRealActualVolumeUtil() > aOpenBins[binRight]->getRealActualVolumeUtil(); });
+        };
+
+        for (const int binIndex : binOrder)
+        {
+            const std::shared_ptr<Bin> &openBin = aOpenBins[binIndex];
+            if (openBin->isRejected(aItemKey) || openBin->wouldExceedLimit(aItemKey))
+            {
+                continue;
+            };
+
+            if (openBin->searchPosition(aItemKey))
+            {
+                return true;
+            };
+
+            PackingCluster::context_->getItemRegister()->resetItem(aItemKey);
+            openBin->rememberRejectedItem(aItemKey);
+        };
+
+        return false;
+    }
+
+    /**
+     * @brief Pack the items with several bins open at once, every item is visited once.
+     *
+     * An item goes to an open bin chosen by the open bin policy of the requested bin. An item no open bin takes opens a new bin,
+     * if the maximum number of open bins is reached the fullest open bin is closed first. A new bin gets an optimized layer
+     * of the items left first, when the cluster is compatible with optimized packing.
+     * A bin is closed as soon as the smallest weight and volume of the items left would exceed its limits.
+     *
+     * @param aItemsToBePacked  - vector containing itemKeys
+     */
+    void startPackingOpenBins(const std::vector<int> &aItemsToBePacked)
+    {
+        const int nrOfItems = (int)aItemsToBePacked.size();
+        const int maxNrOfOpenBins = PackingCluster::context_->getRequestedBin()->getNrOfOpenBins();
+
+        std::vector<double> minWeights;
+        std::vector<double> minVolumes;
+        PackingCluster::getRemainingMinima(aItemsToBePacked, minWeights, minVolumes);
+
+        std::vector<std::shared_ptr<Bin>> openBins;
+        ItemSet layeredItems;
+
+        for (int idx = 0; idx < nrOfItems; idx++)
+        {
+            const int itemKey = aItemsToBePacked[idx];
+            if (layeredItems.contains(itemKey))
+            {
+                continue;
+            };
+
+            for (int binIndex = (int)openBins.size(); binIndex--;)
+            {
+                if (openBins[binIndex]->isFullFor(minWeights[idx], minVolumes[idx]))
+                {
+                    PackingCluster::closeBin(openBins[binIndex]);
+                    openBins.erase(openBins.begin() + binIndex);
+                };
+            };
+
+            bool placed = PackingCluster::placeInOpenBin(openBins, itemKey);
+            while (!placed)
+            {
+                const int nrOfItemsLeft = nrOfItems - idx;
+                PackingCluster::cancelled_ = PackingCluster::context_->isOutscored(PackingCluster::binIdCounter_ + 1);
+                if (!PackingCluster::cancelled_)
+                {
+                    PackingCluster::addBin(minVolumes[idx] > 0 ? (int)std::min((double)nrOfItemsLeft, PackingCluster::context_->getRequestedBin()->getMaxVolume() / minVolumes[idx])
+                                                               : nrOfItemsLeft);
+                };
+
+                if (PackingCluster::cancelled_ || !PackingCluster::compliesWithNrOfAvailableBins())
+                {
+                    if (!PackingCluster::cancelled_)
+                    {
+                        PackingCluster::deleteLastBin();
+                    };
+
+                    for (; idx < nrOfItems; idx++)
+                    {
+                        if (!layeredItems.contains(aItemsToBePacked[idx]))
+                        {
+                            PackingCluster::context_->getItemRegister()->resetItem(aItemsToBePacked[idx]);
+                            PackingCluster::unfittedItems_.push_back(aItemsToBePacked[idx]);
+                        };
+                    };
+                    return;
+                };
+
+                // The new bin starts as a copy of the previous bin or with an optimized layer of the items left.
+                std::vector<int> itemsLeft;
+                itemsLeft.reserve(nrOfItemsLeft);
+                for (int itemIndex = idx; itemIndex < nrOfItems; itemIndex++)
+                {
+                    if (!layeredItems.contains(aItemsToBePacked[itemIndex]))
+                    {
+                        itemsLeft.push_back(aItemsToBePacked[itemIndex]);
+                    };
+                };
+
+                if (PackingCluster::replicatePreviousBin(itemsLeft))
+                {
+                    layeredItems.insert(PackingCluster::getLastCreatedBin()->getFittedItems());
+                }
+                else if (PackingCluster::optimizedPackingCompatible_)
+                {
+                    PackingCluster::optimizedLayerPacking(itemsLeft);
+                    layeredItems.insert(PackingCluster::getLastCreatedBin()->getFittedItems());
+                };
+
+                const std::shared_ptr<Bin> newBin = PackingCluster::getLastCreatedBin();
+                if (layeredItems.contains(itemKey))
+                {
+                    placed = true;
+                }
+                else if (newBin->getFittedItems().empty())
+                {
+                    placed = !newBin->wouldExceedLimit(itemKey) && PackingCluster::placeItem(itemKey, false);
+                    if (placed)
+                    {
+                        newBin->addFittedItem(itemKey);
+                    }
+                    else
+                    {
+                        // The item does not fit in an empty bin, it will never be packed.
+                        PackingCluster::deleteLastBin();
+                        PackingCluster::context_->getItemRegister()->resetItem(itemKey);
+                        PackingCluster::unfittedItems_.push_back(itemKey);
+                        break;
+                    };
+                }
+                else
+                {
+                    placed = !newBin->wouldExceedLimit(itemKey) && newBin->searchPosition(itemKey);
+                    if (!placed)
+                    {
+                        PackingCluster::context_->getItemRegister()->resetItem(itemKey);
+                        newBin->rememberRejectedItem(itemKey);
+                    };
+                };
+
+                if ((int)openBins.size() == maxNrOfOpenBins)
+                {
+                    const int fullestBinIndex = (int)(std::max_element(openBins.begin(), openBins.end(), [](const std::shared_ptr<Bin> &binLeft, const std::shared_ptr<Bin> &binRight)
+                                                                       { return binLeft->getRealActualVolumeUtil() < binRight->getRealActualVolumeUtil(); }) -
+                                                      openBins.begin());
+                    PackingCluster::closeBin(openBins[fullestBinIndex]);
+                    openBins.erase(openBins.begin() + fullestBinIndex);
+                };
+                openBins.push_back(newBin);
+            };
+        };
+    }
+
 public:
     int id_;
     PackingCluster(unsigned int aId,
                    std::shared_ptr<PackingContext> aContext) : id_(aId),
-                                                               context_(aContext)
+                                                               context_(aContext),
+                                                               fullestClosedBinUtil_(-1.0),
+                                                               cancelled_(false),
+                                                               placementKernel_(Bin::selectPlacementKernel(aContext->getRequestedBin()->getPackingDirection(), true, true))
     {
         PackingCluster::binIdCounter_ = 0;
         PackingCluster::setOptimizedPackingCompatible();
@@ -406,6 +964,13 @@ public:
      */
     const int getBinIdCounter() const { return PackingCluster::binIdCounter_; }
 
+    /**
+     * @brief Returns a bool indicating if packing stopped because the incumbent score could not be beaten.
+     *
+     * @return const bool
+     */
+    const bool isCancelled() const { return PackingCluster::cancelled_; };
+
     /**
      * @brief Get the unfitted items belonging to this cluster.
      *
@@ -437,7 +1002,16 @@ public:
      */
     void startPacking(const std::vector<int> &aItemsToBePacked)
     {
-        PackingCluster::startPackingBins(aItemsToBePacked);
+        PackingCluster::selectPlacementKernel(aItemsToBePacked);
+
+        if (PackingCluster::context_->getRequestedBin()->getOpenBinPolicy() == constants::bin::parameter::openBinPolicy::NEXT_FIT)
+        {
+            PackingCluster::startPackingBins(aItemsToBePacked);
+        }
+        else
+        {
+            PackingCluster::startPackingOpenBins(aItemsToBePacked);
+        };
     };
 };
 
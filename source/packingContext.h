@@ -4,6 +4,7 @@
 #include "itemregister.h"
 #include "requestedBin.h"
 #include "gravity.h"
+#include "incumbentScore.h"
 
 /**
  * @brief Represents the context in which the bins will be packed.
@@ -17,13 +18,22 @@ private:
     std::shared_ptr<Gravity> gravity_;
     std::shared_ptr<ItemRegister> itemRegister_;
     std::shared_ptr<RequestedBin> requestedBin_;
+    std::shared_ptr<IncumbentScore> incumbentScore_;
+    std::shared_ptr<ThreadBudget> threadBudget_;
+    double scorePerBin_;
+    int rank_;
+    int maxNrOfBins_;
 
 public:
     PackingContext(std::shared_ptr<Gravity> aGravity,
                    std::shared_ptr<ItemRegister> aItemRegister,
                    std::shared_ptr<RequestedBin> aRequestedBin) : gravity_(aGravity),
                                                                   itemRegister_(aItemRegister),
-                                                                  requestedBin_(aRequestedBin){};
+                                                                  requestedBin_(aRequestedBin),
+                                                                  threadBudget_(std::make_shared<ThreadBudget>(1)),
+                                                                  scorePerBin_(0),
+                                                                  rank_(0),
+                                                                  maxNrOfBins_(0){};
 
     /**
      * @brief Get the requestedBin.
@@ -46,6 +56,61 @@ public:
      */
     const std::shared_ptr<ItemRegister>& getItemRegister() const { return PackingContext::itemRegister_; };
 
+    /**
+     * @brief Set the incumbent score this context competes against, a nullptr means packing is never stopped.
+     *
+     * @param aIncumbentScore
+     * @param aScorePerBin score added by every bin of this context.
+     * @param aRank decides between equal scores, the lower rank wins.
+     */
+    void setIncumbentScore(std::shared_ptr<IncumbentScore> aIncumbentScore, const double aScorePerBin, const int aRank)
+    {
+        PackingContext::incumbentScore_ = aIncumbentScore;
+        PackingContext::scorePerBin_ = aScorePerBin;
+        PackingContext::rank_ = aRank;
+    }
+
+    /**
+     * @brief Set the maximum number of bins packed in this context, 0 means only the available bins of the requested bin limit them.
+     *
+     * @param aMaxNrOfBins
+     */
+    void setMaxNrOfBins(const int aMaxNrOfBins) { PackingContext::maxNrOfBins_ = std::max(aMaxNrOfBins, 0); };
+
+    /**
+     * @brief Checks if the number of bins is more than the requested bin has available or more than the maximum number of bins of this context.
+     *
+     * @param aNrOfBins
+     * @return true
+     * @return false
+     */
+    const bool exceedsNrOfBins(const int aNrOfBins) const
+    {
+        return PackingContext::requestedBin_->exceedsNrOfAvailableBins(aNrOfBins) ||
+               (PackingContext::maxNrOfBins_ > 0 && PackingContext::maxNrOfBins_ < aNrOfBins);
+    }
+
+    /**
+     * @brief Set the thread budget of the request, parallel loops started while packing in this context share it.
+     *
+     * @param aThreadBudget
+     */
+    void setThreadBudget(std::shared_ptr<ThreadBudget> aThreadBudget) { PackingContext::threadBudget_ = aThreadBudget; };
+
+    ThreadBudget &getThreadBudget() const { return *PackingContext::threadBudget_; };
+
+    /**
+     * @brief Checks if packing with the given number of bins can no longer beat the incumbent score.
+     *
+     * @param aNrOfBins
+     * @return true
+     * @return false
+     */
+    const bool isOutscored(const int aNrOfBins) const
+    {
+        return PackingContext::incumbentScore_ && !PackingContext::incumbentScore_->isBeatenBy(aNrOfBins * PackingContext::scorePerBin_, PackingContext::rank_);
+    }
+
     /**
      * @brief Get an Item that can be modified.
      *
@@ -61,6 +126,14 @@ public:
      * @return Item&
      */
     const inline std::shared_ptr<Item>& getItem(const int key) const { return PackingContext::itemRegister_->getConstItem(key); };
+
+    /**
+     * @brief Get an Item for reading attributes that do not depend on its placement, without creating the item object.
+     *
+     * @param key
+     * @return Item&
+     */
+    const inline std::shared_ptr<Item>& peekItem(const int key) const { return PackingContext::itemRegister_->peekItem(key); };
 };
 
 #endif
\ No newline at end of file
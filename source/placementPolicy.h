@@ -0,0 +1,45 @@
+#ifndef PLACEMENT_POLICY_H
+#define PLACEMENT_POLICY_H
+
+class Bin;
+
+/**
+ * @brief Packing directions of the placement kernel, the bin axes along which positions are searched in search order.
+ *
+ */
+struct BottomUp
+{
+    static constexpr std::array<int, 3> AXES = constants::bin::parameter::BOTTOM_UP_ARRAY;
+};
+
+struct BackToFront
+{
+    static constexpr std::array<int, 3> AXES = constants::bin::parameter::BACK_TO_FRONT_ARRAY;
+};
+
+/**
+ * @brief Decisions of the placement kernel which are the same for every item of a packing cluster, fixed at compile time.
+ *
+ * A kernel that does not check gravity or stacking styles leaves these checks out of its inner loops, it may only be used
+ * if the checks can not reject a position: gravity is off for the bin and for all items and no item has a stacking style.
+ *
+ */
+template <typename Direction, bool ChecksGravity, bool ChecksStackingStyles>
+struct PlacementPolicy
+{
+    using PackingDirection = Direction;
+    static constexpr bool CHECKS_GRAVITY = ChecksGravity;
+    static constexpr bool CHECKS_STACKING_STYLES = ChecksStackingStyles;
+};
+
+/**
+ * @brief Placement functions of a bin specialized for one placement policy, picked once per packing cluster.
+ *
+ */
+struct PlacementKernel
+{
+    const bool (Bin::*searchPosition_)(const int);
+    const bool (Bin::*placeItem_)(const int);
+};
+
+#endif
@@ -0,0 +1,90 @@
+#ifndef RADIX_SORT_H
+#define RADIX_SORT_H
+
+namespace RadixSort
+{
+    /**
+     * @brief Sort key of an item, the words are compared from first to last.
+     *
+     * The key is extracted once, so sorting does not have to look up items.
+     *
+     */
+    struct ItemSortKey
+    {
+        std::array<uint64_t, 4> words_;
+        int itemKey_;
+    };
+
+    /**
+     * @brief Map a double to an unsigned integer with the same order.
+     *
+     * @param aValue
+     * @return const uint64_t
+     */
+    inline const uint64_t orderedBits(const double aValue)
+    {
+        uint64_t bits;
+        std::memcpy(&bits, &aValue, sizeof(bits));
+        return (bits >> 63) ? ~bits : bits | (uint64_t(1) << 63);
+    }
+
+    /**
+     * @brief Stable counting sort on one byte of one word.
+     *
+     * Returns false without touching the keys if all keys have the same byte.
+     *
+     * @param aKeys
+     * @param aBuffer
+     * @param aWord
+     * @param aShift
+     * @return true
+     * @return false
+     */
+    inline const bool sortByByte(std::vector<ItemSortKey> &aKeys, std::vector<ItemSortKey> &aBuffer, const int aWord, const int aShift)
+    {
+        std::array<int, 257> offsets = {};
+        for (const ItemSortKey &key : aKeys)
+        {
+            offsets[((key.words_[aWord] >> aShift) & 0xFF) + 1]++;
+        };
+
+        for (int idx = 1; idx < (int)offsets.size(); idx++)
+        {
+            if (offsets[idx] == (int)aKeys.size())
+            {
+                return false;
+            };
+            offsets[idx] += offsets[idx - 1];
+        };
+
+        for (const ItemSortKey &key : aKeys)
+        {
+            aBuffer[offsets[(key.words_[aWord] >> aShift) & 0xFF]++] = key;
+        };
+
+        return true;
+    }
+
+    /**
+     * @brief Sort the keys ascending on their words, least significant byte first.
+     *
+     * @param aKeys
+     */
+    inline void sort(std::vector<ItemSortKey> &aKeys)
+    {
+        std::vector<ItemSortKey> buffer(aKeys.size());
+
+        for (int word = (int)std::tuple_size<decltype(ItemSortKey::words_)>::value; word--;)
+        {
+            for (int shift = 0; shift < 64; shift += 8)
+            {
+                if (RadixSort::sortByByte(aKeys, buffer, word, shift))
+                {
+                    aKeys.swap(buffer);
+                };
+            };
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,881 @@
+#ifndef REQUEST_PARSER_H
+#define REQUEST_PARSER_H
+
+/**
+ * @brief Single pass parser for the incoming packing request.
+ *
+ * Reads the bins/items request directly from the incoming character buffer without building a json document first.
+ * Keys are dispatched with a compile time hash, every key of the schema maps onto its own case label so a collision
+ * between two keys results in a compile error. Unknown keys are skipped.
+ *
+ * Missing fields get the same defaults as before, empty strings, 0 for numbers and no compatible bins.
+ *
+ */
+class RequestParser
+{
+private:
+    struct BinRecord
+    {
+        std::string type_;
+        double width_ = 0.0;
+        double depth_ = 0.0;
+        double height_ = 0.0;
+        double maxWeight_ = 0.0;
+        int nrOfAvailableBins_ = 0;
+        int itemLimit_ = 0;
+        std::string packingDirection_;
+        std::string sortMethod_;
+        double gravityStrength_ = 0.0;
+        std::string openBinPolicy_;
+        int nrOfOpenBins_ = 0;
+        int nrOfZones_ = 1;
+        int nrOfSpeculativeBins_ = 0;
+    };
+
+    struct ItemRecord
+    {
+        std::string id_;
+        double width_ = 0.0;
+        double depth_ = 0.0;
+        double height_ = 0.0;
+        double weight_ = 0.0;
+        std::string itemConsolidationKey_;
+        std::string allowedRotations_;
+        double gravityStrength_ = 0.0;
+        std::vector<std::string> compatibleBins_;
+        std::string stackingStyle_;
+        int quantity_ = 1;
+    };
+
+    const char *cursor_;
+    const char *end_;
+    bool valid_;
+    std::string keyBuffer_;
+    std::vector<BinRecord> bins_;
+    std::vector<ItemRecord> items_;
+    int nrOfItems_;
+    int maxNrOfThreads_;
+    int maxNrOfItemsPerShard_;
+
+    /**
+     * @brief FNV-1a hash of a key, usable in case labels.
+     *
+     * @param aKey
+     * @param aLength
+     * @return constexpr unsigned int
+     */
+    static constexpr unsigned int hashKey(const char *aKey, const std::size_t aLength)
+    {
+        unsigned int hash = 2166136261u;
+        for (std::size_t idx = 0; idx < aLength; idx++)
+        {
+            hash ^= (unsigned char)aKey[idx];
+            hash *= 16777619u;
+        }
+        return hash;
+    }
+
+    static constexpr unsigned int hashKey(const char *aKey)
+    {
+        std::size_t length = 0;
+        while (aKey[length] != '\0')
+        {
+            length++;
+        }
+        return RequestParser::hashKey(aKey, length);
+    }
+
+    inline void skipWhitespace()
+    {
+        while (RequestParser::cursor_ < RequestParser::end_ &&
+               (*RequestParser::cursor_ == ' ' || *RequestParser::cursor_ == '\n' || *RequestParser::cursor_ == '\r' || *RequestParser::cursor_ == '\t'))
+        {
+            RequestParser::cursor_++;
+        }
+    }
+
+    /**
+     * @brief Consume the expected character, invalidates the request if it is not found.
+     *
+     * @param aCharacter
+     * @return true
+     * @return false
+     */
+    inline const bool consume(const char aCharacter)
+    {
+        RequestParser::skipWhitespace();
+        if (RequestParser::cursor_ < RequestParser::end_ && *RequestParser::cursor_ == aCharacter)
+        {
+            RequestParser::cursor_++;
+            return true;
+        }
+
+        RequestParser::valid_ = false;
+        return false;
+    }
+
+    /**
+     * @brief Checks if the next character equals aCharacter, consumes it if so.
+     *
+     * @param aCharacter
+     * @return true
+     * @return false
+     */
+    inline const bool peekAndConsume(const char aCharacter)
+    {
+        RequestParser::skipWhitespace();
+        if (RequestParser::cursor_ < RequestParser::end_ && *RequestParser::cursor_ == aCharacter)
+        {
+            RequestParser::cursor_++;
+            return true;
+        }
+        return false;
+    }
+
+    inline const char peek()
+    {
+        RequestParser::skipWhitespace();
+        return RequestParser::cursor_ < RequestParser::end_ ? *RequestParser::cursor_ : '\0';
+    }
+
+    /**
+     * @brief Append a unicode code point to a string as utf-8.
+     *
+     * @param aCodePoint
+     * @param aTarget
+     */
+    void appendUtf8(const unsigned int aCodePoint, std::string &aTarget) const
+    {
+        if (aCodePoint < 0x80)
+        {
+            aTarget.push_back((char)aCodePoint);
+        }
+        else if (aCodePoint < 0x800)
+        {
+            aTarget.push_back((char)(0xC0 | (aCodePoint >> 6)));
+            aTarget.push_back((char)(0x80 | (aCodePoint & 0x3F)));
+        }
+        else if (aCodePoint < 0x10000)
+        {
+            aTarget.push_back((char)(0xE0 | (aCodePoint >> 12)));
+            aTarget.push_back((char)(0x80 | ((aCodePoint >> 6) & 0x3F)));
+            aTarget.push_back((char)(0x80 | (aCodePoint & 0x3F)));
+        }
+        else
+        {
+            aTarget.push_back((char)(0xF0 | (aCodePoint >> 18)));
+            aTarget.push_back((char)(0x80 | ((aCodePoint >> 12) & 0x3F)));
+            aTarget.push_back((char)(0x80 | ((aCodePoint >> 6) & 0x3F)));
+            aTarget.push_back((char)(0x80 | (aCodePoint & 0x3F)));
+        }
+    }
+
+    /**
+     * @brief Read four hexadecimal characters.
+     *
+     * @param aCodeUnit
+     * @return true
+     * @return false
+     */
+    const bool readHexQuad(unsigned int &aCodeUnit)
+    {
+        aCodeUnit = 0;
+        for (int idx = 0; idx < 4; idx++)
+        {
+            if (RequestParser::cursor_ >= RequestParser::end_)
+            {
+                return false;
+            }
+
+            const char c = *RequestParser::cursor_++;
+            aCodeUnit <<= 4;
+            if (c >= '0' && c <= '9')
+            {
+                aCodeUnit += c - '0';
+            }
+            else if (c >= 'a' && c <= 'f')
+            {
+                aCodeUnit += c - 'a' + 10;
+            }
+            else if (c >= 'A' && c <= 'F')
+            {
+                aCodeUnit += c - 'A' + 10;
+            }
+            else
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Decode the remainder of a string containing escape sequences.
+     *
+     * The cursor is expected to be on the first backslash, the string content up to that point is already in aTarget.
+     *
+     * @param aTarget
+     */
+    void decodeEscapedString(std::string &aTarget)
+    {
+        while (RequestParser::cursor_ < RequestParser::end_ && *RequestParser::cursor_ != '"')
+        {
+            const char c = *RequestParser::cursor_++;
+            if (c != '\\')
+            {
+                aTarget.push_back(c);
+                continue;
+            }
+
+            if (RequestParser::cursor_ >= RequestParser::end_)
+            {
+                break;
+            }
+
+            const char escaped = *RequestParser::cursor_++;
+            switch (escaped)
+            {
+            case 'b':
+                aTarget.push_back('\b');
+                break;
+            case 'f':
+                aTarget.push_back('\f');
+                break;
+            case 'n':
+                aTarget.push_back('\n');
+                break;
+            case 'r':
+                aTarget.push_back('\r');
+                break;
+            case 't':
+                aTarget.push_back('\t');
+                break;
+            case 'u':
+            {
+                unsigned int codePoint = 0;
+                if (!RequestParser::readHexQuad(codePoint))
+                {
+                    RequestParser::valid_ = false;
+                    return;
+                }
+
+                // Combine surrogate pairs.
+                if (codePoint >= 0xD800 && codePoint <= 0xDBFF &&
+                    RequestParser::end_ - RequestParser::cursor_ >= 6 &&
+                    RequestParser::cursor_[0] == '\\' && RequestParser::cursor_[1] == 'u')
+                {
+                    RequestParser::cursor_ += 2;
+                    unsigned int lowSurrogate = 0;
+                    if (!RequestParser::readHexQuad(lowSurrogate))
+                    {
+                        RequestParser::valid_ = false;
+                        return;
+                    }
+                    codePoint = 0x10000 + ((codePoint & 0x3FF) << 10) + (lowSurrogate & 0x3FF);
+                }
+                RequestParser::appendUtf8(codePoint, aTarget);
+                break;
+            }
+            default:
+                aTarget.push_back(escaped);
+            }
+        }
+    }
+
+    /**
+     * @brief Read a string, a view directly into the buffer is returned when the string contains no escape sequences.
+     *
+     * The view is only valid until the next call.
+     *
+     * @param aTarget
+     * @return true
+     * @return false
+     */
+    const bool readStringView(std::string_view &aTarget)
+    {
+        if (!RequestParser::consume('"'))
+        {
+            return false;
+        }
+
+        const char *start = RequestParser::cursor_;
+        while (RequestParser::cursor_ < RequestParser::end_ && *RequestParser::cursor_ != '"' && *RequestParser::cursor_ != '\\')
+        {
+            RequestParser::cursor_++;
+        }
+
+        if (RequestParser::cursor_ < RequestParser::end_ && *RequestParser::cursor_ == '\\')
+        {
+            RequestParser::keyBuffer_.assign(start, RequestParser::cursor_);
+            RequestParser::decodeEscapedString(RequestParser::keyBuffer_);
+            aTarget = std::string_view(RequestParser::keyBuffer_);
+        }
+        else
+        {
+            aTarget = std::string_view(start, RequestParser::cursor_ - start);
+        }
+
+        return RequestParser::consume('"');
+    }
+
+    /**
+     * @brief Returns the length of the number token under the cursor.
+     *
+     * @return const std::size_t
+     */
+    const std::size_t numberTokenLength() const
+    {
+        const char *it = RequestParser::cursor_;
+        while (it < RequestParser::end_ &&
+               ((*it >= '0' && *it <= '9') || *it == '-' || *it == '+' || *it == '.' || *it == 'e' || *it == 'E'))
+        {
+            it++;
+        }
+        return it - RequestParser::cursor_;
+    }
+
+    /**
+     * @brief Consume a literal such as true, false or null.
+     *
+     * @param aLiteral
+     * @param aLength
+     * @return true
+     * @return false
+     */
+    const bool consumeLiteral(const char *aLiteral, const std::size_t aLength)
+    {
+        if ((std::size_t)(RequestParser::end_ - RequestParser::cursor_) >= aLength &&
+            std::memcmp(RequestParser::cursor_, aLiteral, aLength) == 0)
+        {
+            RequestParser::cursor_ += aLength;
+            return true;
+        }
+
+        RequestParser::valid_ = false;
+        return false;
+    }
+
+    /**
+     * @brief Read a numeric value. Booleans are converted to 1 and 0, null and other types result in 0.
+     *
+     * @param aTarget
+     */
+    void readDouble(double &aTarget)
+    {
+        const char c = RequestParser::peek();
+        if (c == '-' || (c >= '0' && c <= '9'))
+        {
+            const std::size_t length = RequestParser::numberTokenLength();
+
+            // The buffer is not guaranteed to be terminated behind the number, copy small tokens to a terminated buffer.
+            char token[64];
+            if (length >= sizeof(token))
+            {
+                RequestParser::valid_ = false;
+                return;
+            }
+            std::memcpy(token, RequestParser::cursor_, length);
+            token[length] = '\0';
+
+            char *tokenEnd = nullptr;
+            aTarget = std::strtod(token, &tokenEnd);
+            if (tokenEnd != token + length)
+            {
+                RequestParser::valid_ = false;
+            }
+            RequestParser::cursor_ += length;
+            return;
+        }
+
+        aTarget = 0.0;
+        if (c == 't')
+        {
+            aTarget = RequestParser::consumeLiteral("true", 4) ? 1.0 : 0.0;
+            return;
+        }
+        RequestParser::skipValue();
+    }
+
+    /**
+     * @brief Read an integer value, decimals are truncated.
+     *
+     * @param aTarget
+     */
+    void readInt(int &aTarget)
+    {
+        double value = 0.0;
+        RequestParser::readDouble(value);
+        aTarget = (int)value;
+    }
+
+    /**
+     * @brief Read an item quantity, clamped to the int range.
+     *
+     * @param aTarget
+     */
+    void readQuantity(int &aTarget)
+    {
+        double value = 1.0;
+        RequestParser::readDouble(value);
+        aTarget = value < std::numeric_limits<int>::max() ? (int)std::max(value, 0.0) : std::numeric_limits<int>::max();
+    }
+
+    /**
+     * @brief Read a string value. Numbers and booleans are returned as their textual representation, null as empty string.
+     *
+     * @param aTarget
+     */
+    void readString(std::string &aTarget)
+    {
+        const char c = RequestParser::peek();
+        if (c == '"')
+        {
+            std::string_view value;
+            RequestParser::readStringView(value);
+            aTarget.assign(value.data(), value.size());
+            return;
+        }
+
+        aTarget.clear();
+        if (c == '-' || (c >= '0' && c <= '9'))
+        {
+            const std::size_t length = RequestParser::numberTokenLength();
+            aTarget.assign(RequestParser::cursor_, length);
+            RequestParser::cursor_ += length;
+            return;
+        }
+        if (c == 't' && RequestParser::consumeLiteral("true", 4))
+        {
+            aTarget = "true";
+            return;
+        }
+        if (c == 'f' && RequestParser::consumeLiteral("false", 5))
+        {
+            aTarget = "false";
+            return;
+        }
+        RequestParser::skipValue();
+    }
+
+    /**
+     * @brief Read an array of strings.
+     *
+     * @param aTarget
+     */
+    void readStringArray(std::vector<std::string> &aTarget)
+    {
+        aTarget.clear();
+        if (RequestParser::peek() != '[')
+        {
+            RequestParser::skipValue();
+            return;
+        }
+
+        RequestParser::consume('[');
+        if (RequestParser::peekAndConsume(']'))
+        {
+            return;
+        }
+
+        do
+        {
+            aTarget.emplace_back();
+            RequestParser::readString(aTarget.back());
+        } while (RequestParser::valid_ && RequestParser::peekAndConsume(','));
+
+        RequestParser::consume(']');
+    }
+
+    /**
+     * @brief Skip over any value, used for unknown keys.
+     *
+     */
+    void skipValue()
+    {
+        switch (RequestParser::peek())
+        {
+        case '"':
+        {
+            std::string_view ignored;
+            RequestParser::readStringView(ignored);
+            return;
+        }
+        case '{':
+        {
+            RequestParser::consume('{');
+            if (RequestParser::peekAndConsume('}'))
+            {
+                return;
+            }
+            do
+            {
+                std::string_view ignored;
+                RequestParser::readStringView(ignored);
+                RequestParser::consume(':');
+                RequestParser::skipValue();
+            } while (RequestParser::valid_ && RequestParser::peekAndConsume(','));
+            RequestParser::consume('}');
+            return;
+        }
+        case '[':
+        {
+            RequestParser::consume('[');
+            if (RequestParser::peekAndConsume(']'))
+            {
+                return;
+            }
+            do
+            {
+                RequestParser::skipValue();
+            } while (RequestParser::valid_ && RequestParser::peekAndConsume(','));
+            RequestParser::consume(']');
+            return;
+        }
+        case 't':
+            RequestParser::consumeLiteral("true", 4);
+            return;
+        case 'f':
+            RequestParser::consumeLiteral("false", 5);
+            return;
+        case 'n':
+            RequestParser::consumeLiteral("null", 4);
+            return;
+        default:
+            const std::size_t length = RequestParser::numberTokenLength();
+            if (length == 0)
+            {
+                RequestParser::valid_ = false;
+            }
+            RequestParser::cursor_ += length;
+        }
+    }
+
+    /**
+     * @brief Iterate over the members of an object, calling aMemberHandler with the key hash and key for each member.
+     *
+     * The handler is responsible for reading the value.
+     *
+     * @tparam Handler
+     * @param aMemberHandler
+     */
+    template <class Handler>
+    void readObject(Handler aMemberHandler)
+    {
+        if (RequestParser::peek() != '{')
+        {
+            RequestParser::skipValue();
+            return;
+        }
+
+        RequestParser::consume('{');
+        if (RequestParser::peekAndConsume('}'))
+        {
+            return;
+        }
+
+        do
+        {
+            std::string_view key;
+            if (!RequestParser::readStringView(key) || !RequestParser::consume(':'))
+            {
+                return;
+            }
+            aMemberHandler(RequestParser::hashKey(key.data(), key.size()), key);
+        } while (RequestParser::valid_ && RequestParser::peekAndConsume(','));
+
+        RequestParser::consume('}');
+    }
+
+    /**
+     * @brief Iterate over the elements of an array, calling aElementHandler for each element.
+     *
+     * @tparam Handler
+     * @param aElementHandler
+     */
+    template <class Handler>
+    void readArray(Handler aElementHandler)
+    {
+        if (RequestParser::peek() != '[')
+        {
+            RequestParser::skipValue();
+            return;
+        }
+
+        RequestParser::consume('[');
+        if (RequestParser::peekAndConsume(']'))
+        {
+            return;
+        }
+
+        do
+        {
+            aElementHandler();
+        } while (RequestParser::valid_ && RequestParser::peekAndConsume(','));
+
+        RequestParser::consume(']');
+    }
+
+    void readBin(BinRecord &aBin)
+    {
+        RequestParser::readObject([&](const unsigned int aKeyHash, const std::string_view aKey)
+                                  {
+            namespace keys = constants::json::inbound::bins;
+            switch (aKeyHash)
+            {
+            case RequestParser::hashKey(keys::TYPE):
+                if (aKey == keys::TYPE) { return RequestParser::readString(aBin.type_); }
+                break;
+            case RequestParser::hashKey(keys::WIDTH):
+                if (aKey == keys::WIDTH) { return RequestParser::readDouble(aBin.width_); }
+                break;
+            case RequestParser::hashKey(keys::DEPTH):
+                if (aKey == keys::DEPTH) { return RequestParser::readDouble(aBin.depth_); }
+                break;
+            case RequestParser::hashKey(keys::HEIGHT):
+                if (aKey == keys::HEIGHT) { return RequestParser::readDouble(aBin.height_); }
+                break;
+            case RequestParser::hashKey(keys::MAX_WEIGHT):
+                if (aKey == keys::MAX_WEIGHT) { return RequestParser::readDouble(aBin.maxWeight_); }
+                break;
+            case RequestParser::hashKey(keys::NR_OF_AVAILABLE_BINS):
+                if (aKey == keys::NR_OF_AVAILABLE_BINS) { return RequestParser::readInt(aBin.nrOfAvailableBins_); }
+                break;
+            case RequestParser::hashKey(keys::ITEM_LIMIT):
+                if (aKey == keys::ITEM_LIMIT) { return RequestParser::readInt(aBin.itemLimit_); }
+                break;
+            case RequestParser::hashKey(keys::PACKING_DIRECTION):
+                if (aKey == keys::PACKING_DIRECTION) { return RequestParser::readString(aBin.packingDirection_); }
+                break;
+            case RequestParser::hashKey(keys::SORT_METHOD):
+                if (aKey == keys::SORT_METHOD) { return RequestParser::readString(aBin.sortMethod_); }
+                break;
+            case RequestParser::hashKey(keys::GRAVITY_STRENGTH):
+                if (aKey == keys::GRAVITY_STRENGTH) { return RequestParser::readDouble(aBin.gravityStrength_); }
+                break;
+            case RequestParser::hashKey(keys::OPEN_BIN_POLICY):
+                if (aKey == keys::OPEN_BIN_POLICY) { return RequestParser::readString(aBin.openBinPolicy_); }
+                break;
+            case RequestParser::hashKey(keys::NR_OF_OPEN_BINS):
+                if (aKey == keys::NR_OF_OPEN_BINS) { return RequestParser::readInt(aBin.nrOfOpenBins_); }
+                break;
+            case RequestParser::hashKey(keys::NR_OF_ZONES):
+                if (aKey == keys::NR_OF_ZONES) { return RequestParser::readInt(aBin.nrOfZones_); }
+                break;
+            case RequestParser::hashKey(keys::NR_OF_SPECULATIVE_BINS):
+                if (aKey == keys::NR_OF_SPECULATIVE_BINS) { return RequestParser::readInt(aBin.nrOfSpeculativeBins_); }
+                break;
+            };
+            RequestParser::skipValue(); });
+    }
+
+    void readItem(ItemRecord &aItem)
+    {
+        RequestParser::readObject([&](const unsigned int aKeyHash, const std::string_view aKey)
+                                  {
+            namespace keys = constants::json::item;
+            switch (aKeyHash)
+            {
+            case RequestParser::hashKey(keys::ID):
+                if (aKey == keys::ID) { return RequestParser::readString(aItem.id_); }
+                break;
+            case RequestParser::hashKey(keys::WIDTH):
+                if (aKey == keys::WIDTH) { return RequestParser::readDouble(aItem.width_); }
+                break;
+            case RequestParser::hashKey(keys::DEPTH):
+                if (aKey == keys::DEPTH) { return RequestParser::readDouble(aItem.depth_); }
+                break;
+            case RequestParser::hashKey(keys::HEIGHT):
+                if (aKey == keys::HEIGHT) { return RequestParser::readDouble(aItem.height_); }
+                break;
+            case RequestParser::hashKey(keys::WEIGHT):
+                if (aKey == keys::WEIGHT) { return RequestParser::readDouble(aItem.weight_); }
+                break;
+            case RequestParser::hashKey(keys::ITEM_CONS_KEY):
+                if (aKey == keys::ITEM_CONS_KEY) { return RequestParser::readString(aItem.itemConsolidationKey_); }
+                break;
+            case RequestParser::hashKey(keys::ALLOWED_ROTATIONS):
+                if (aKey == keys::ALLOWED_ROTATIONS) { return RequestParser::readString(aItem.allowedRotations_); }
+                break;
+            case RequestParser::hashKey(keys::GRAVITY_STRENGTH):
+                if (aKey == keys::GRAVITY_STRENGTH) { return RequestParser::readDouble(aItem.gravityStrength_); }
+                break;
+            case RequestParser::hashKey(keys::COMPATIBLE_BINS):
+                if (aKey == keys::COMPATIBLE_BINS) { return RequestParser::readStringArray(aItem.compatibleBins_); }
+                break;
+            case RequestParser::hashKey(keys::STACKING_STYLE):
+                if (aKey == keys::STACKING_STYLE) { return RequestParser::readString(aItem.stackingStyle_); }
+                break;
+            case RequestParser::hashKey(keys::QUANTITY):
+                if (aKey == keys::QUANTITY) { return RequestParser::readQuantity(aItem.quantity_); }
+                break;
+            };
+            RequestParser::skipValue(); });
+    }
+
+    /**
+     * @brief Parse the complete request.
+     *
+     */
+    void parse()
+    {
+        RequestParser::readObject([&](const unsigned int aKeyHash, const std::string_view aKey)
+                                  {
+            switch (aKeyHash)
+            {
+            case RequestParser::hashKey(constants::json::inbound::bins::BINS):
+                if (aKey == constants::json::inbound::bins::BINS)
+                {
+                    RequestParser::bins_.clear();
+                    return RequestParser::readArray([&]()
+                                                    {
+                        RequestParser::bins_.emplace_back();
+                        RequestParser::readBin(RequestParser::bins_.back()); });
+                }
+                break;
+            case RequestParser::hashKey(constants::json::inbound::item::ITEMS):
+                if (aKey == constants::json::inbound::item::ITEMS)
+                {
+                    RequestParser::items_.clear();
+                    return RequestParser::readArray([&]()
+                                                    {
+                        RequestParser::items_.emplace_back();
+                        RequestParser::readItem(RequestParser::items_.back()); });
+                }
+                break;
+            case RequestParser::hashKey(constants::json::inbound::request::MAX_NR_OF_THREADS):
+                if (aKey == constants::json::inbound::request::MAX_NR_OF_THREADS) { return RequestParser::readInt(RequestParser::maxNrOfThreads_); }
+                break;
+            case RequestParser::hashKey(constants::json::inbound::request::MAX_NR_OF_ITEMS_PER_SHARD):
+                if (aKey == constants::json::inbound::request::MAX_NR_OF_ITEMS_PER_SHARD) { return RequestParser::readInt(RequestParser::maxNrOfItemsPerShard_); }
+                break;
+            };
+            RequestParser::skipValue(); });
+
+        // Item lines with a quantity of 0 or less hold no items, the total must fit the int item keys.
+        RequestParser::items_.erase(std::remove_if(RequestParser::items_.begin(), RequestParser::items_.end(), [](const ItemRecord &item)
+                                                   { return item.quantity_ <= 0; }),
+                                    RequestParser::items_.end());
+        long long nrOfItems = 0;
+        for (const ItemRecord &item : RequestParser::items_)
+        {
+            nrOfItems += item.quantity_;
+        }
+        RequestParser::valid_ = RequestParser::valid_ && nrOfItems <= std::numeric_limits<int>::max();
+
+        // A malformed request is handled as an empty request.
+        if (!RequestParser::valid_)
+        {
+            RequestParser::bins_.clear();
+            RequestParser::items_.clear();
+            nrOfItems = 0;
+        }
+
+        RequestParser::nrOfItems_ = (int)nrOfItems;
+    }
+
+public:
+    RequestParser(const char *aJson) : cursor_(aJson),
+                                       end_(aJson + std::strlen(aJson)),
+                                       valid_(true),
+                                       nrOfItems_(0),
+                                       maxNrOfThreads_(0),
+                                       maxNrOfItemsPerShard_(0)
+    {
+        RequestParser::parse();
+    };
+
+    RequestParser(const char *aJson, const std::size_t aLength) : cursor_(aJson),
+                                                                  end_(aJson + aLength),
+                                                                  valid_(true),
+                                                                  nrOfItems_(0),
+                                                                  maxNrOfThreads_(0),
+                                                                  maxNrOfItemsPerShard_(0)
+    {
+        RequestParser::parse();
+    };
+
+    const bool isValid() const { return RequestParser::valid_; };
+    const int getNumberOfBins() const { return (int)RequestParser::bins_.size(); };
+    const int getNumberOfItems() const { return RequestParser::nrOfItems_; };
+
+    /**
+     * @brief Get the number of threads the request may use, 0 or less means the default number of threads.
+     *
+     * @return const int
+     */
+    const int getMaxNrOfThreads() const
+    {
+        return RequestParser::maxNrOfThreads_ > 0 ? std::min(RequestParser::maxNrOfThreads_, constants::taskScheduler::MAX_NR_OF_PARTICIPANTS) : DEFAULT_MAX_THREADS_PER_REQUEST;
+    };
+
+    /**
+     * @brief Get the maximum number of items of a shard, 0 or less means the default shard size.
+     *
+     * @return const int
+     */
+    const int getMaxNrOfItemsPerShard() const
+    {
+        return RequestParser::maxNrOfItemsPerShard_ > 0 ? RequestParser::maxNrOfItemsPerShard_ : DEFAULT_MAX_NR_OF_ITEMS_PER_SHARD;
+    };
+
+    /**
+     * @brief Add the parsed bins and items to the bin composer.
+     *
+     * Bins and items are added last to first, items get their position in the request as transient id.
+     * An item line with a quantity is added as one item type, its items get consecutive transient ids.
+     *
+     * @param aBinComposer
+     */
+    void populate(std::shared_ptr<BinComposer> &aBinComposer) const
+    {
+        for (int idx = RequestParser::bins_.size(); idx--;)
+        {
+            const BinRecord &bin = RequestParser::bins_[idx];
+            std::shared_ptr<RequestedBin> requestedBin = std::make_shared<RequestedBin>(bin.type_,
+                                                                                        bin.width_ * MULTIPLIER,
+                                                                                        bin.depth_ * MULTIPLIER,
+                                                                                        bin.height_ * MULTIPLIER,
+                                                                                        bin.maxWeight_,
+                                                                                        bin.nrOfAvailableBins_,
+                                                                                        bin.itemLimit_,
+                                                                                        bin.packingDirection_,
+                                                                                        bin.sortMethod_,
+                                                                                        bin.gravityStrength_);
+            requestedBin->setOpenBinPolicy(bin.openBinPolicy_, bin.nrOfOpenBins_);
+            requestedBin->setNrOfZones(bin.nrOfZones_);
+            requestedBin->setNrOfSpeculativeBins(bin.nrOfSpeculativeBins_);
+            aBinComposer->addRequestedBin(requestedBin);
+        };
+
+        int itemKey = RequestParser::nrOfItems_;
+        for (int idx = RequestParser::items_.size(); idx--;)
+        {
+            const ItemRecord &item = RequestParser::items_[idx];
+            const int firstItemKey = itemKey - item.quantity_ + 1;
+
+            const std::shared_ptr<Item> itemType =
+                std::make_shared<Item>(firstItemKey,
+                                       item.id_,
+                                       item.width_ * MULTIPLIER,
+                                       item.depth_ * MULTIPLIER,
+                                       item.height_ * MULTIPLIER,
+                                       item.weight_,
+                                       item.itemConsolidationKey_,
+                                       item.allowedRotations_,
+                                       item.gravityStrength_,
+                                       std::vector<std::string>(item.compatibleBins_.rbegin(), item.compatibleBins_.rend()),
+                                       Item::getStackingStyle(item.stackingStyle_));
+
+            // Item types are kept in the state of an unpacked item.
+            itemType->reset();
+
+            for (; itemKey >= firstItemKey; itemKey--)
+            {
+                aBinComposer->getMasterItemRegister()->addItem(itemKey, itemType);
+                aBinComposer->addItem(itemKey);
+            };
+        };
+    }
+};
+
+#endif
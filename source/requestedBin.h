@@ -11,6 +11,7 @@ class RequestedBin
 {
 private:
     std::string type_;
+    int typeId_;
     int maxWidth_;
     int maxDepth_;
     int maxHeight_;
@@ -23,6 +24,10 @@ private:
     std::array<int, 3> packingDirection_;
     std::string itemSortMethod_;
     double binGravityStrength_;
+    int openBinPolicy_;
+    int nrOfOpenBins_;
+    int nrOfZones_;
+    int nrOfSpeculativeBins_;
 
     /**
      * @brief Set the desired packing direction of the bin.
@@ -55,6 +60,7 @@ public:
                  std::string aPackingDirection,
                  std::string aItemSortMethod,
                  double aBinGravityStrength) : type_(aBinType),
+                                               typeId_(-1),
                                                maxWidth_(aBinWidth),
                                                maxDepth_(aBinDepth),
                                                maxHeight_(aBinHeight),
@@ -62,13 +68,22 @@ public:
                                                nrOfAvailableBins_(aNrOfAvailableBins),
                                                itemLimit_(aItemLimit),
                                                itemSortMethod_(aItemSortMethod),
-                                               binGravityStrength_(aBinGravityStrength)
+                                               binGravityStrength_(aBinGravityStrength),
+                                               openBinPolicy_(constants::bin::parameter::openBinPolicy::NEXT_FIT),
+                                               nrOfOpenBins_(1),
+                                               nrOfZones_(1),
+                                               nrOfSpeculativeBins_(0)
     {
         RequestedBin::maxVolume_ = ((double)RequestedBin::maxWidth_ / MULTIPLIER) * ((double)RequestedBin::maxDepth_ / MULTIPLIER) * ((double)RequestedBin::maxHeight_ / MULTIPLIER);
         RequestedBin::setPackingDirection(aPackingDirection);
     };
 
-    const std::string getType() const { return RequestedBin::type_; };
+    const std::string &getType() const { return RequestedBin::type_; };
+
+    /// @brief Id of the bin type, bins of the same type share the id.
+    /// @return const int
+    const int getTypeId() const { return RequestedBin::typeId_; };
+    void setTypeId(const int aTypeId) { RequestedBin::typeId_ = aTypeId; };
 
     const int getWidth() const { return RequestedBin::maxWidth_; };
     const int getDepth() const { return RequestedBin::maxDepth_; };
@@ -84,6 +99,82 @@ public:
     const std::string &getItemSortMethod() const { return RequestedBin::itemSortMethod_; }
     const double &getBinGravityStrength() const { return RequestedBin::binGravityStrength_; }
 
+    /**
+     * @brief Set the policy that decides in which open bin an item is placed.
+     *
+     * Next fit keeps a single bin open. First and best fit keep up to aNrOfOpenBins bins open, 0 means the default number.
+     *
+     * @param aPolicy
+     * @param aNrOfOpenBins
+     */
+    void setOpenBinPolicy(std::string aPolicy, const int aNrOfOpenBins)
+    {
+        std::transform(aPolicy.begin(), aPolicy.end(), aPolicy.begin(), ::toupper);
+
+        if (aPolicy == constants::bin::parameter::FIRST_FIT_TEXT)
+        {
+            RequestedBin::openBinPolicy_ = constants::bin::parameter::openBinPolicy::FIRST_FIT;
+        }
+        else if (aPolicy == constants::bin::parameter::BEST_FIT_TEXT)
+        {
+            RequestedBin::openBinPolicy_ = constants::bin::parameter::openBinPolicy::BEST_FIT;
+        }
+        else
+        {
+            RequestedBin::openBinPolicy_ = constants::bin::parameter::openBinPolicy::NEXT_FIT;
+        };
+
+        RequestedBin::nrOfOpenBins_ = RequestedBin::openBinPolicy_ == constants::bin::parameter::openBinPolicy::NEXT_FIT ? 1
+                                      : aNrOfOpenBins > 0                                                              ? aNrOfOpenBins
+                                                                                                                       : constants::bin::parameter::DEFAULT_NR_OF_OPEN_BINS;
+    };
+
+    const int getOpenBinPolicy() const { return RequestedBin::openBinPolicy_; };
+    const int getNrOfOpenBins() const { return RequestedBin::nrOfOpenBins_; };
+
+    /**
+     * @brief Set the number of zones a bin is split into along its depth, the zones are packed at the same time.
+     *
+     * 1 packs the bin as a whole.
+     *
+     * @param aNrOfZones
+     */
+    void setNrOfZones(const int aNrOfZones) { RequestedBin::nrOfZones_ = std::max(aNrOfZones, 1); };
+    const int getNrOfZones() const { return RequestedBin::nrOfZones_; };
+
+    /**
+     * @brief Set the number of bins packed at the same time after every bin packed one by one, 0 packs all bins one by one.
+     *
+     * Each of these bins is packed with the items predicted to end up in it, so the bins can differ from bins packed one by one.
+     *
+     * @param aNrOfSpeculativeBins
+     */
+    void setNrOfSpeculativeBins(const int aNrOfSpeculativeBins) { RequestedBin::nrOfSpeculativeBins_ = std::max(aNrOfSpeculativeBins, 0); };
+    const int getNrOfSpeculativeBins() const { return RequestedBin::nrOfSpeculativeBins_; };
+
+    /**
+     * @brief Get the requested bin of a single zone, a slice of the bin of the given depth.
+     *
+     * The zone gets an equal share of the weight and item limit, so the zones together stay within the limits of the bin.
+     *
+     * @param aZoneDepth
+     * @return const std::shared_ptr<RequestedBin>
+     */
+    const std::shared_ptr<RequestedBin> getZone(const int aZoneDepth) const
+    {
+        std::shared_ptr<RequestedBin> zone = std::make_shared<RequestedBin>(*this);
+        zone->maxDepth_ = aZoneDepth;
+        zone->maxVolume_ = ((double)zone->maxWidth_ / MULTIPLIER) * ((double)zone->maxDepth_ / MULTIPLIER) * ((double)zone->maxHeight_ / MULTIPLIER);
+        zone->maxWeight_ = RequestedBin::maxWeight_ / RequestedBin::nrOfZones_;
+        zone->itemLimit_ = RequestedBin::itemLimit_ > 0 ? RequestedBin::itemLimit_ / RequestedBin::nrOfZones_ : RequestedBin::itemLimit_;
+        zone->nrOfAvailableBins_ = 0;
+        zone->nrOfZones_ = 1;
+        return zone;
+    }
+
+    // Set to 0 if not limited.
+    const int getNrOfAvailableBins() const { return RequestedBin::nrOfAvailableBins_; };
+
     // Set to -1 if not applicable.
     const int getItemLimit() const { return RequestedBin::itemLimit_; };
 
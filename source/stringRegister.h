@@ -0,0 +1,95 @@
+#ifndef STRING_REGISTER_H
+#define STRING_REGISTER_H
+
+/**
+ * @brief Intern table for the strings of a packing request.
+ *
+ * Every distinct string gets a small integer id, so the packing itself can compare ids instead of strings.
+ * The strings are only needed again when the result is written.
+ *
+ */
+class StringRegister
+{
+private:
+    std::vector<std::string> strings_;
+    std::unordered_map<std::string, int> ids_;
+
+public:
+    StringRegister(){};
+
+    /**
+     * @brief Get the id of a string, a string which is not known yet is added to the register.
+     *
+     * @param aString
+     * @return const int
+     */
+    const int getId(const std::string &aString)
+    {
+        const std::pair<std::unordered_map<std::string, int>::iterator, bool> result = StringRegister::ids_.emplace(aString, (int)StringRegister::strings_.size());
+
+        if (result.second)
+        {
+            StringRegister::strings_.push_back(aString);
+        };
+
+        return result.first->second;
+    }
+
+    /**
+     * @brief Get the id of a known string, -1 if the string is not in the register.
+     *
+     * @param aString
+     * @return const int
+     */
+    const int findId(const std::string &aString) const
+    {
+        const std::unordered_map<std::string, int>::const_iterator result = StringRegister::ids_.find(aString);
+        return result == StringRegister::ids_.end() ? -1 : result->second;
+    }
+
+    /**
+     * @brief Get the string of an id.
+     *
+     * @param aId
+     * @return const std::string&
+     */
+    const std::string &getString(const int aId) const { return StringRegister::strings_[aId]; };
+
+    /**
+     * @brief Get the number of distinct strings.
+     *
+     * @return const int
+     */
+    const int size() const { return (int)StringRegister::strings_.size(); };
+
+    /**
+     * @brief Renumber the strings in lexicographic order, comparing ids then gives the same result as comparing the strings.
+     *
+     * Returns the new id for every old id, ids handed out before have to be replaced by the caller.
+     *
+     * @return const std::vector<int>
+     */
+    const std::vector<int> sort()
+    {
+        std::vector<int> sortedIds(StringRegister::strings_.size());
+        std::iota(sortedIds.begin(), sortedIds.end(), 0);
+        std::sort(sortedIds.begin(), sortedIds.end(), [this](const int idLeft, const int idRight)
+                  { return StringRegister::strings_[idLeft] < StringRegister::strings_[idRight]; });
+
+        std::vector<int> newIds(StringRegister::strings_.size());
+        std::vector<std::string> sortedStrings;
+        sortedStrings.reserve(StringRegister::strings_.size());
+
+        for (int idx = 0; idx < (int)sortedIds.size(); idx++)
+        {
+            newIds[sortedIds[idx]] = idx;
+            sortedStrings.push_back(std::move(StringRegister::strings_[sortedIds[idx]]));
+            StringRegister::ids_[sortedStrings.back()] = idx;
+        };
+
+        StringRegister::strings_ = std::move(sortedStrings);
+        return newIds;
+    }
+};
+
+#endif
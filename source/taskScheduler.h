@@ -0,0 +1,289 @@
+#ifndef TASK_SCHEDULER_H
+#define TASK_SCHEDULER_H
+
+/**
+ * @brief Number of threads a single request may use, shared by all parallel loops the request starts, nested ones included.
+ *
+ * The thread that handles the request always works, the budget limits the number of worker threads that help it.
+ *
+ */
+class ThreadBudget
+{
+private:
+    const int maxNrOfHelpers_;
+    std::atomic<int> nrOfHelpers_;
+
+public:
+    ThreadBudget(const int aMaxNrOfThreads) : maxNrOfHelpers_(std::max(aMaxNrOfThreads, 1) - 1),
+                                              nrOfHelpers_(0){};
+
+    const bool allowsHelpers() const { return ThreadBudget::maxNrOfHelpers_ > 0; };
+
+    /**
+     * @brief Claim a helper thread, fails when the budget is used up.
+     *
+     * @return true
+     * @return false
+     */
+    const bool tryAcquireHelper()
+    {
+        int nrOfHelpers = ThreadBudget::nrOfHelpers_.load();
+        while (nrOfHelpers < ThreadBudget::maxNrOfHelpers_)
+        {
+            if (ThreadBudget::nrOfHelpers_.compare_exchange_weak(nrOfHelpers, nrOfHelpers + 1))
+            {
+                return true;
+            };
+        };
+        return false;
+    }
+
+    void releaseHelper() { ThreadBudget::nrOfHelpers_--; };
+};
+
+/**
+ * @brief The tasks of a single parallel loop, it lives on the stack of the thread that started the loop.
+ *
+ * Every participant owns a range of task indices, packed as begin << 32 | end. A participant takes tasks from the front
+ * of its own range, when it is empty it steals the back half of the range of another participant.
+ *
+ */
+class TaskGroup
+{
+private:
+    friend class TaskScheduler;
+
+    void (*runTask_)(void *, const int);
+    void *task_;
+    ThreadBudget &threadBudget_;
+    std::array<std::atomic<uint64_t>, constants::taskScheduler::MAX_NR_OF_PARTICIPANTS> ranges_;
+    std::atomic<int> nrOfParticipants_;
+    std::atomic<int> nrOfActiveHelpers_;
+
+    static const uint64_t packRange(const uint32_t aBegin, const uint32_t aEnd) { return (uint64_t)aBegin << 32 | aEnd; };
+
+    /**
+     * @brief Take the first task of the range of a participant.
+     *
+     * @param aParticipant
+     * @param aTaskIndex
+     * @return true
+     * @return false
+     */
+    const bool takeTask(const int aParticipant, int &aTaskIndex)
+    {
+        uint64_t range = TaskGroup::ranges_[aParticipant].load();
+        while ((uint32_t)(range >> 32) < (uint32_t)range)
+        {
+            if (TaskGroup::ranges_[aParticipant].compare_exchange_weak(range, TaskGroup::packRange((uint32_t)(range >> 32) + 1, (uint32_t)range)))
+            {
+                aTaskIndex = (int)(range >> 32);
+                return true;
+            };
+        };
+        return false;
+    }
+
+    /**
+     * @brief Move the back half of the range of another participant to the range of the given participant.
+     *
+     * @param aParticipant
+     * @return true
+     * @return false
+     */
+    const bool stealTasks(const int aParticipant)
+    {
+        for (int offset = 1; offset < TaskGroup::nrOfParticipants_; offset++)
+        {
+            std::atomic<uint64_t> &victimRange = TaskGroup::ranges_[(aParticipant + offset) % TaskGroup::nrOfParticipants_];
+            uint64_t range = victimRange.load();
+            while ((uint32_t)(range >> 32) < (uint32_t)range)
+            {
+                const uint32_t begin = (uint32_t)(range >> 32);
+                const uint32_t end = (uint32_t)range;
+                const uint32_t middle = begin + (end - begin) / 2;
+                if (victimRange.compare_exchange_weak(range, TaskGroup::packRange(begin, middle)))
+                {
+                    TaskGroup::ranges_[aParticipant].store(TaskGroup::packRange(middle, end));
+                    return true;
+                };
+            };
+        };
+        return false;
+    }
+
+    /**
+     * @brief Run tasks until no participant has tasks left.
+     *
+     * @param aParticipant
+     */
+    void participate(const int aParticipant)
+    {
+        int taskIndex = 0;
+        do
+        {
+            while (TaskGroup::takeTask(aParticipant, taskIndex))
+            {
+                TaskGroup::runTask_(TaskGroup::task_, taskIndex);
+            };
+        } while (TaskGroup::stealTasks(aParticipant));
+    }
+
+    const bool hasTasks() const
+    {
+        for (int idx = 0; idx < TaskGroup::nrOfParticipants_; idx++)
+        {
+            const uint64_t range = TaskGroup::ranges_[idx].load();
+            if ((uint32_t)(range >> 32) < (uint32_t)range)
+            {
+                return true;
+            };
+        };
+        return false;
+    }
+
+public:
+    TaskGroup(const int aNrOfTasks, ThreadBudget &aThreadBudget, void (*aRunTask)(void *, const int), void *aTask) : runTask_(aRunTask),
+                                                                                                                   task_(aTask),
+                                                                                                                   threadBudget_(aThreadBudget),
+                                                                                                                   nrOfParticipants_(1),
+                                                                                                                   nrOfActiveHelpers_(0)
+    {
+        TaskGroup::ranges_[0].store(TaskGroup::packRange(0, (uint32_t)aNrOfTasks));
+    };
+};
+
+/**
+ * @brief Worker threads shared by all requests, every parallel loop of the engine submits its tasks here.
+ *
+ * The number of worker threads is the global thread cap, a loop only gets helpers within the thread budget of its request.
+ * Tasks are indices of a loop, running a task does not allocate. A task writes its result to the slot of its index
+ * and the caller reduces the slots in index order, so the result does not depend on which thread ran which task.
+ * A task may start a loop of its own, the thread running it takes part in the inner loop while idle workers help.
+ *
+ */
+class TaskScheduler
+{
+private:
+    std::mutex mutex_;
+    std::condition_variable taskGroupOpened_;
+    std::condition_variable helpersLeft_;
+    std::vector<TaskGroup *> openTaskGroups_;
+    int nrOfWorkers_;
+
+    TaskScheduler(const int aNrOfWorkers) : nrOfWorkers_(std::max(aNrOfWorkers, 0))
+    {
+        TaskScheduler::openTaskGroups_.reserve(constants::taskScheduler::MAX_NR_OF_PARTICIPANTS);
+        for (int idx = 0; idx < TaskScheduler::nrOfWorkers_; idx++)
+        {
+            std::thread(&TaskScheduler::work, this).detach();
+        };
+    };
+
+    /**
+     * @brief Get the shared scheduler, it is created on first use and lives as long as the process.
+     *
+     * @return TaskScheduler&
+     */
+    static TaskScheduler &getInstance()
+    {
+        static TaskScheduler *taskScheduler = new TaskScheduler(MAX_NR_OF_WORKER_THREADS);
+        return *taskScheduler;
+    }
+
+    template <typename Task>
+    static void runTask(void *aTask, const int aTaskIndex) { (*static_cast<Task *>(aTask))(aTaskIndex); };
+
+    /**
+     * @brief Join an open task group with tasks left whose request still has room in its thread budget, the caller holds the mutex.
+     *
+     * @param aParticipant
+     * @return TaskGroup*
+     */
+    TaskGroup *joinTaskGroup(int &aParticipant)
+    {
+        for (TaskGroup *taskGroup : TaskScheduler::openTaskGroups_)
+        {
+            if (taskGroup->nrOfParticipants_ < constants::taskScheduler::MAX_NR_OF_PARTICIPANTS &&
+                taskGroup->hasTasks() &&
+                taskGroup->threadBudget_.tryAcquireHelper())
+            {
+                aParticipant = taskGroup->nrOfParticipants_;
+                taskGroup->ranges_[aParticipant].store(0);
+                taskGroup->nrOfParticipants_++;
+                taskGroup->nrOfActiveHelpers_++;
+                return taskGroup;
+            };
+        };
+        return nullptr;
+    }
+
+    void work()
+    {
+        std::unique_lock<std::mutex> lock(TaskScheduler::mutex_);
+        while (true)
+        {
+            int participant = 0;
+            TaskGroup *taskGroup = TaskScheduler::joinTaskGroup(participant);
+            if (!taskGroup)
+            {
+                TaskScheduler::taskGroupOpened_.wait(lock);
+                continue;
+            };
+
+            lock.unlock();
+            taskGroup->participate(participant);
+            taskGroup->threadBudget_.releaseHelper();
+            lock.lock();
+            taskGroup->nrOfActiveHelpers_--;
+            if (taskGroup->nrOfActiveHelpers_ == 0)
+            {
+                TaskScheduler::helpersLeft_.notify_all();
+            };
+        };
+    }
+
+public:
+    /**
+     * @brief Run aTask(idx) for every idx in [0, aNrOfTasks) and return when all tasks are done.
+     *
+     * Runs on the calling thread only when the budget allows no helpers or there are no worker threads.
+     *
+     * @param aNrOfTasks
+     * @param aThreadBudget
+     * @param aTask
+     */
+    template <typename Task>
+    static void parallelFor(const int aNrOfTasks, ThreadBudget &aThreadBudget, Task &aTask)
+    {
+        if (aNrOfTasks <= 1 || !aThreadBudget.allowsHelpers() || MAX_NR_OF_WORKER_THREADS <= 0)
+        {
+            for (int idx = 0; idx < aNrOfTasks; idx++)
+            {
+                aTask(idx);
+            };
+            return;
+        };
+
+        TaskScheduler &taskScheduler = TaskScheduler::getInstance();
+        TaskGroup taskGroup(aNrOfTasks, aThreadBudget, &TaskScheduler::runTask<Task>, &aTask);
+        {
+            std::lock_guard<std::mutex> lock(taskScheduler.mutex_);
+            taskScheduler.openTaskGroups_.push_back(&taskGroup);
+        }
+        taskScheduler.taskGroupOpened_.notify_all();
+
+        taskGroup.participate(0);
+
+        // Helpers join under the mutex, once the group is closed only the helpers already in it can still hold tasks.
+        std::unique_lock<std::mutex> lock(taskScheduler.mutex_);
+        taskScheduler.openTaskGroups_.erase(std::find(taskScheduler.openTaskGroups_.begin(), taskScheduler.openTaskGroups_.end(), &taskGroup));
+
+        // Helpers leave under the mutex, so the group is not destroyed while a helper still touches it.
+        // A task can run for a long time, the calling thread sleeps until the last helper has left.
+        taskScheduler.helpersLeft_.wait(lock, [&taskGroup]()
+                                        { return taskGroup.nrOfActiveHelpers_ == 0; });
+    }
+};
+
+#endif